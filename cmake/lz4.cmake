@@ -39,9 +39,18 @@ ENDMACRO()
 MACRO (MYSQL_USE_BUNDLED_LZ4)
   SET(WITH_LZ4 "bundled" CACHE STRING "By default use bundled lz4 library")
   SET(BUILD_BUNDLED_LZ4 1)
-  INCLUDE_DIRECTORIES(BEFORE SYSTEM ${CMAKE_SOURCE_DIR}/extra/lz4)
 
   IF (MYSQL_SOURCE_DIR AND MYSQL_BUILD_DIR)
+    FILE(GLOB_RECURSE LZ4_INCLUDE_FILE ${MYSQL_SOURCE_DIR}/extra/lz4/*/lz4frame.h)
+
+    IF (NOT LZ4_INCLUDE_FILE)
+      MESSAGE(FATAL_ERROR "Could not find \"lz4frame.h\" in ${MYSQL_SOURCE_DIR}/extra/lz4, set MYSQL_SOURCE_DIR or use -DWITH_LZ4=system")
+    ENDIF()
+
+    LIST(GET LZ4_INCLUDE_FILE 0 LZ4_INCLUDE_FILE)
+    GET_FILENAME_COMPONENT(LZ4_INCLUDE_DIR ${LZ4_INCLUDE_FILE} DIRECTORY)
+    INCLUDE_DIRECTORIES(BEFORE SYSTEM ${LZ4_INCLUDE_DIR})
+
     IF (WIN32)
       find_file(LZ4_LIBRARY NAMES "lz4_lib.lib" PATHS "${MYSQL_BUILD_DIR}/${CMAKE_BUILD_TYPE}" "${MYSQL_BUILD_DIR}/utilities/${CMAKE_BUILD_TYPE}" "${MYSQL_BUILD_DIR}/archive_output_directory/${CMAKE_BUILD_TYPE}" NO_DEFAULT_PATH)
     ELSE()
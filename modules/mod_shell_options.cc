@@ -139,6 +139,11 @@ shell should read passwords from stdin instead of the tty
 
 @li resultFormat: controls the type of output produced for SQL results.
 
+@li resultFormat.tableSampleRows: number of rows used to calculate column
+widths when printing results in table format. If 0, widths are calculated
+using column metadata and rows are printed as they are fetched. Default is
+1000.
+
 @li sandboxDir: default path where the new sandbox instances for InnoDB
 cluster will be deployed
 
@@ -162,6 +167,12 @@ If not defined the standard SSH paths will be used (~/.ssh/config).
 
 @li ssh.bufferSize integer default 10240 bytes, used for tunnel data transfer
 
+@li rest.maxConnections integer default 8, maximum number of idle connections
+kept alive to the object storage services.
+
+@li rest.http2 boolean default false, if enabled HTTP/2 is negotiated when
+connecting to the object storage services.
+
 The resultFormat option supports the following values to modify the
 format of printed query results:
 
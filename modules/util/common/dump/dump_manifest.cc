@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/dump/dump_manifest.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_json.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/version.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+namespace {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+const mysqlshdk::utils::Version k_current_version{1, 0, 0};
+
+constexpr std::string_view k_magic = "MSHDMNF1";
+
+// index offset + index size + magic
+constexpr std::size_t k_footer_size = 2 * sizeof(uint64_t) + k_magic.size();
+
+void append_uint64(uint64_t value, std::string *out) {
+  for (int i = 0; i < 8; ++i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+uint64_t read_uint64(const char *data) {
+  uint64_t value = 0;
+
+  for (int i = 7; i >= 0; --i) {
+    value = (value << 8) | static_cast<unsigned char>(data[i]);
+  }
+
+  return value;
+}
+
+std::string checksum(std::string_view contents) {
+  const auto hash = shcore::ssl::sha256(contents.data(), contents.size());
+  return shcore::string_to_hex(
+      {reinterpret_cast<const char *>(hash.data()), hash.size()}, false);
+}
+
+std::string compress(std::string_view contents, Compression compression) {
+  if (Compression::NONE == compression) {
+    return std::string{contents};
+  }
+
+  auto memory = std::make_unique<Memory_file>("");
+  const auto output = memory.get();
+  const auto file =
+      mysqlshdk::storage::make_file(std::move(memory), compression);
+
+  file->open(Mode::WRITE);
+  file->write(contents.data(), contents.size());
+  file->close();
+
+  return output->content();
+}
+
+std::string decompress(std::string_view contents, Compression compression) {
+  if (Compression::NONE == compression) {
+    return std::string{contents};
+  }
+
+  auto memory = std::make_unique<Memory_file>("");
+  memory->set_content(std::string{contents});
+  const auto file =
+      mysqlshdk::storage::make_file(std::move(memory), compression);
+
+  std::string result;
+  char buffer[16 * 1024];
+  ssize_t bytes;
+
+  file->open(Mode::READ);
+
+  while ((bytes = file->read(buffer, sizeof(buffer))) > 0) {
+    result.append(buffer, bytes);
+  }
+
+  file->close();
+
+  if (bytes < 0) {
+    throw std::runtime_error("Failed to decompress manifest entry");
+  }
+
+  return result;
+}
+
+}  // namespace
+
+Dump_manifest_writer::Dump_manifest_writer(Compression compression)
+    : m_compression(compression) {}
+
+void Dump_manifest_writer::add(const std::string &name,
+                               std::string_view contents) {
+  // compress outside of the lock
+  auto data = compress(contents, m_compression);
+  auto hash = checksum(contents);
+
+  std::lock_guard lock{m_mutex};
+
+  m_entries.emplace_back(Entry{name, m_data.size(), data.size(),
+                               contents.size(), std::move(hash)});
+  m_data.append(data);
+}
+
+void Dump_manifest_writer::write(
+    const std::unordered_set<mysqlshdk::storage::IDirectory::File_info> &files,
+    std::unique_ptr<mysqlshdk::storage::IFile> file) const {
+  shcore::JSON_dumper json;
+
+  json.start_object();
+  json.append("version", k_current_version.get_full());
+  json.append("compression", mysqlshdk::storage::to_string(m_compression));
+  json.append("entries");
+  json.start_object();
+
+  for (const auto &entry : m_entries) {
+    const auto info = files.find(entry.name);
+
+    if (files.end() == info) {
+      log_warning("%s: file not found, it is not going to be written to the "
+                  "dump manifest",
+                  entry.name.c_str());
+      continue;
+    }
+
+    json.append(entry.name);
+    json.start_array();
+    json.append_uint64(entry.offset);
+    json.append_uint64(entry.size);
+    json.append_uint64(entry.file_size);
+    json.append_string(info->version());
+    json.append_string(entry.checksum);
+    json.end_array();
+  }
+
+  json.end_object();
+  json.end_object();
+
+  const auto &index = json.str();
+  std::string footer;
+
+  append_uint64(m_data.size(), &footer);
+  append_uint64(index.size(), &footer);
+  footer.append(k_magic);
+
+  file->open(Mode::WRITE);
+  file->write(m_data.data(), m_data.size());
+  file->write(index.data(), index.size());
+  file->write(footer.data(), footer.size());
+  file->close();
+}
+
+Dump_manifest_reader::Dump_manifest_reader(mysqlshdk::storage::IFile *file) {
+  file->open(Mode::READ);
+  m_data = mysqlshdk::storage::read_file(file);
+  file->close();
+
+  const auto fail = [file](const std::string &msg) {
+    throw std::runtime_error("Malformed dump manifest " +
+                             file->full_path().masked() + ": " + msg);
+  };
+
+  if (m_data.size() < k_footer_size ||
+      std::string_view{m_data}.substr(m_data.size() - k_magic.size()) !=
+          k_magic) {
+    fail("invalid footer");
+  }
+
+  const auto footer = m_data.data() + m_data.size() - k_footer_size;
+  const auto index_offset = read_uint64(footer);
+  const auto index_size = read_uint64(footer + sizeof(uint64_t));
+
+  if (index_offset > m_data.size() || index_size > m_data.size() ||
+      index_offset + index_size + k_footer_size != m_data.size()) {
+    fail("invalid index location");
+  }
+
+  shcore::Dictionary_t index;
+
+  try {
+    index = shcore::Value::parse(
+                std::string_view{m_data}.substr(index_offset, index_size))
+                .as_map();
+    m_compression =
+        mysqlshdk::storage::to_compression(index->get_string("compression"));
+  } catch (const std::exception &e) {
+    fail(std::string{"invalid index: "} + e.what());
+  }
+
+  const auto version =
+      mysqlshdk::utils::Version(index->get_string("version", "0.0.0"));
+
+  if (version.get_major() != k_current_version.get_major()) {
+    fail("unsupported version " + version.get_full());
+  }
+
+  const auto entries = index->get_map("entries");
+
+  if (!entries) {
+    fail("missing entries");
+  }
+
+  m_entries.reserve(entries->size());
+
+  for (const auto &entry : *entries) {
+    const auto location = entry.second.as_array();
+
+    if (!location || location->size() != 5) {
+      fail("invalid entry " + entry.first);
+    }
+
+    const auto offset = location->at(0).as_uint();
+    const auto size = location->at(1).as_uint();
+
+    if (offset > index_offset || size > index_offset - offset) {
+      fail("invalid location of entry " + entry.first);
+    }
+
+    m_entries.emplace(entry.first,
+                      Entry{offset, size, location->at(2).as_uint(),
+                            location->at(3).as_string(),
+                            location->at(4).as_string()});
+  }
+
+  // index is no longer needed
+  m_data.resize(index_offset);
+  m_data.shrink_to_fit();
+}
+
+std::optional<std::string> Dump_manifest_reader::fetch(
+    const std::string &name) const {
+  const auto entry = m_entries.find(name);
+
+  if (m_entries.end() == entry) {
+    return {};
+  }
+
+  auto contents = decompress(std::string_view{m_data}.substr(
+                                 entry->second.offset, entry->second.size),
+                             m_compression);
+
+  if (checksum(contents) != entry->second.checksum) {
+    log_warning("%s: checksum of the dump manifest entry does not match",
+                name.c_str());
+    return {};
+  }
+
+  return contents;
+}
+
+void Dump_manifest_reader::remove_if(
+    const std::function<bool(const std::string &, uint64_t,
+                             const std::string &)> &predicate) {
+  std::erase_if(m_entries, [&predicate](const auto &entry) {
+    return predicate(entry.first, entry.second.file_size,
+                     entry.second.version);
+  });
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_DUMP_DUMP_MANIFEST_H_
+#define MODULES_UTIL_COMMON_DUMP_DUMP_MANIFEST_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+/**
+ * Name of the file which holds the dump manifest.
+ */
+inline constexpr std::string_view k_dump_manifest_file = "@.manifest";
+
+/**
+ * Dump manifest holds a copy of all schema/table metadata files and DDL
+ * scripts of a dump, so that these can be fetched using a single read
+ * operation, instead of fetching each file separately.
+ *
+ * Layout of the file:
+ *  - entries - contents of the files, each one compressed separately,
+ *  - index - JSON document with compression type, and name, offset, size,
+ *    uncompressed size, version of the file (as reported by the storage) and
+ *    SHA-256 checksum of the uncompressed contents of each entry,
+ *  - footer - offset and size of the index, stored as 64-bit little-endian
+ *    integers, followed by a magic string.
+ */
+class Dump_manifest_writer final {
+ public:
+  explicit Dump_manifest_writer(mysqlshdk::storage::Compression compression);
+
+  Dump_manifest_writer(const Dump_manifest_writer &) = delete;
+  Dump_manifest_writer(Dump_manifest_writer &&) = delete;
+
+  Dump_manifest_writer &operator=(const Dump_manifest_writer &) = delete;
+  Dump_manifest_writer &operator=(Dump_manifest_writer &&) = delete;
+
+  ~Dump_manifest_writer() = default;
+
+  /**
+   * Adds an entry to the manifest. Thread-safe.
+   *
+   * @param name Name of the file.
+   * @param contents Contents of the file.
+   */
+  void add(const std::string &name, std::string_view contents);
+
+  /**
+   * Writes the manifest to the given file. Entries which are not in the list
+   * of files are skipped.
+   *
+   * @param files Files of the dump, version of each entry is taken from here.
+   * @param file Output file.
+   */
+  void write(
+      const std::unordered_set<mysqlshdk::storage::IDirectory::File_info>
+          &files,
+      std::unique_ptr<mysqlshdk::storage::IFile> file) const;
+
+ private:
+  struct Entry {
+    std::string name;
+    uint64_t offset;
+    uint64_t size;
+    uint64_t file_size;
+    std::string checksum;
+  };
+
+  mysqlshdk::storage::Compression m_compression;
+
+  std::mutex m_mutex;
+  std::string m_data;
+  std::vector<Entry> m_entries;
+};
+
+/**
+ * Reads the dump manifest, entries are decompressed on demand.
+ */
+class Dump_manifest_reader final {
+ public:
+  /**
+   * Reads the whole manifest using a single read operation.
+   *
+   * @param file Input file.
+   *
+   * @throws std::runtime_error if manifest is malformed
+   */
+  explicit Dump_manifest_reader(mysqlshdk::storage::IFile *file);
+
+  Dump_manifest_reader(const Dump_manifest_reader &) = delete;
+  Dump_manifest_reader(Dump_manifest_reader &&) = default;
+
+  Dump_manifest_reader &operator=(const Dump_manifest_reader &) = delete;
+  Dump_manifest_reader &operator=(Dump_manifest_reader &&) = default;
+
+  ~Dump_manifest_reader() = default;
+
+  /**
+   * Provides contents of the given file. Thread-safe.
+   *
+   * @param name Name of the file.
+   *
+   * @returns contents of the file, or nothing if manifest does not contain
+   *          such file or its contents do not match the checksum
+   */
+  std::optional<std::string> fetch(const std::string &name) const;
+
+  /**
+   * Removes entries for which the given predicate returns true, i.e. the ones
+   * which no longer match the files stored in the dump.
+   *
+   * @param predicate Called with name of the file, its size and version.
+   */
+  void remove_if(const std::function<bool(const std::string &, uint64_t,
+                                          const std::string &)> &predicate);
+
+  /**
+   * Number of entries in the manifest.
+   */
+  inline std::size_t size() const noexcept { return m_entries.size(); }
+
+ private:
+  struct Entry {
+    uint64_t offset;
+    uint64_t size;
+    uint64_t file_size;
+    std::string version;
+    std::string checksum;
+  };
+
+  mysqlshdk::storage::Compression m_compression =
+      mysqlshdk::storage::Compression::NONE;
+  std::string m_data;
+  std::unordered_map<std::string, Entry> m_entries;
+};
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_DUMP_DUMP_MANIFEST_H_
@@ -25,11 +25,13 @@
 
 #include "modules/util/common/dump/utils.h"
 
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/storage/backend/oci_par_directory_config.h"
+#include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
@@ -157,6 +159,39 @@ std::shared_ptr<mysqlshdk::oci::IPAR_config> get_par_config(
   return {};
 }
 
+std::string validate_where_clause(const std::string &schema,
+                                  const std::string &table,
+                                  const std::string &where) {
+  // prevent SQL injection
+  mysqlshdk::utils::SQL_iterator it{where};
+  int parentheses = 0;
+
+  const auto throw_error = [&schema, &table, &where]() {
+    throw std::invalid_argument("Malformed condition used for table '" +
+                                schema + "'.'" + table + "': " + where);
+  };
+
+  while (it.valid()) {
+    const auto token = it.next_token();
+
+    if (shcore::str_caseeq("(", token)) {
+      ++parentheses;
+    } else if (shcore::str_caseeq(")", token)) {
+      --parentheses;
+
+      if (parentheses < 0) {
+        throw_error();
+      }
+    }
+  }
+
+  if (parentheses != 0) {
+    throw_error();
+  }
+
+  return '(' + where + ')';
+}
+
 }  // namespace common
 }  // namespace dump
 }  // namespace mysqlsh
@@ -71,6 +71,21 @@ std::shared_ptr<mysqlshdk::oci::IPAR_config> get_par_config(
 std::shared_ptr<mysqlshdk::oci::IPAR_config> get_par_config(
     const mysqlshdk::oci::PAR_structure &par);
 
+/**
+ * Validates the condition used to filter rows of the given table.
+ *
+ * @param schema Schema of the table.
+ * @param table Name of the table.
+ * @param where Condition to be validated.
+ *
+ * @returns condition enclosed in parentheses
+ *
+ * @throws std::invalid_argument if condition is malformed
+ */
+std::string validate_where_clause(const std::string &schema,
+                                  const std::string &table,
+                                  const std::string &where);
+
 }  // namespace common
 }  // namespace dump
 }  // namespace mysqlsh
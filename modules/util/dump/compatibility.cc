@@ -25,6 +25,7 @@
 
 #include "modules/util/dump/compatibility.h"
 
+#include <cctype>
 #include <cassert>
 #include <regex>
 #include <unordered_map>
@@ -660,6 +661,122 @@ bool check_create_table_for_fixed_row_format(const std::string &create_table,
   return !offsets.empty();
 }
 
+void Create_table_option_filter::reset(std::string_view create_table) {
+  m_statement.assign(create_table);
+  m_keywords.assign(create_table);
+  m_validated[0] = m_validated[1] = false;
+
+  for (auto &c : m_keywords) {
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+}
+
+bool Create_table_option_filter::data_index_dir_option(bool fix) {
+  if (!contains("directory")) return false;
+
+  const auto res = check_create_table_for_data_index_dir_option(
+      m_statement, fix ? &m_rewritten : nullptr);
+
+  if (fix) update(std::move(m_rewritten));
+
+  return res;
+}
+
+bool Create_table_option_filter::encryption_option(bool fix) {
+  if (!contains("encryption")) return false;
+
+  const auto res = check_create_table_for_encryption_option(
+      m_statement, fix ? &m_rewritten : nullptr);
+
+  if (fix) update(std::move(m_rewritten));
+
+  return res;
+}
+
+std::string Create_table_option_filter::engine_option(bool fix,
+                                                 const std::string &target) {
+  if (!contains("engine")) {
+    validate(false);
+    return {};
+  }
+
+  auto res = check_create_table_for_engine_option(
+      m_statement, fix ? &m_rewritten : nullptr, target);
+  m_validated[0] = true;
+
+  if (fix) {
+    update(std::move(m_rewritten));
+
+    // engine name could match one of the keywords
+    for (const auto c : target) {
+      m_keywords.push_back(
+          static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+  }
+
+  return res;
+}
+
+bool Create_table_option_filter::fixed_row_format(bool fix) {
+  if (!contains("row_format")) {
+    validate(false);
+
+    if (fix) {
+      // statement is stripped, even if option was not found
+      update(shcore::str_strip(m_statement, " \r\n\t,"));
+    }
+
+    return false;
+  }
+
+  const auto res = check_create_table_for_fixed_row_format(
+      m_statement, fix ? &m_rewritten : nullptr);
+  m_validated[0] = true;
+
+  if (fix) update(std::move(m_rewritten));
+
+  return res;
+}
+
+bool Create_table_option_filter::tablespace_option(
+    bool fix, const std::vector<std::string> &whitelist) {
+  if (!contains("tablespace")) {
+    validate(true);
+    return false;
+  }
+
+  const auto res = check_create_table_for_tablespace_option(
+      m_statement, fix ? &m_rewritten : nullptr, whitelist);
+  m_validated[1] = true;
+
+  if (fix) update(std::move(m_rewritten));
+
+  return res;
+}
+
+bool Create_table_option_filter::contains(std::string_view keyword) const {
+  // filters only remove, comment out or replace the existing text, if keyword
+  // is not present in the original statement or in the replacement text, it's
+  // not going to be found by the filter
+  return std::string::npos != m_keywords.find(keyword);
+}
+
+void Create_table_option_filter::validate(bool include_quoted) {
+  // the check_create_table_for_*() functions throw if statement is malformed
+  if (!m_validated[include_quoted]) {
+    SQL_iterator it(m_statement, 0, !include_quoted);
+    skip_columns_definition(&it);
+    m_validated[include_quoted] = true;
+  }
+}
+
+void Create_table_option_filter::update(std::string &&rewritten) {
+  if (rewritten != m_statement) {
+    std::swap(m_statement, rewritten);
+    m_validated[0] = m_validated[1] = false;
+  }
+}
+
 std::vector<std::string> check_statement_for_charset_option(
     const std::string &statement, std::string *rewritten,
     const std::vector<std::string> &whitelist) {
@@ -104,6 +104,104 @@ bool check_create_table_for_tablespace_option(
 bool check_create_table_for_fixed_row_format(const std::string &create_table,
                                              std::string *rewritten = nullptr);
 
+/**
+ * Keyword pre-filter for the check_create_table_for_*() functions which handle
+ * the table options of a CREATE TABLE statement.
+ *
+ * This class does not parse or rewrite the statement on its own. Each method
+ * first checks if the keyword handled by the corresponding function is present
+ * in the statement, and if it is not, the call is skipped (function would not
+ * find anything either). Otherwise, the function is called and does the actual
+ * work in a separate pass over the statement. Typically only the ENGINE option
+ * is present, so most of these passes are skipped.
+ *
+ * Calling the methods in a given order produces the same result as calling the
+ * corresponding functions in that order. Buffers are reused between the
+ * statements.
+ *
+ * This class is not thread-safe.
+ */
+class Create_table_option_filter final {
+ public:
+  Create_table_option_filter() = default;
+
+  Create_table_option_filter(const Create_table_option_filter &) = delete;
+  Create_table_option_filter(Create_table_option_filter &&) = delete;
+
+  Create_table_option_filter &operator=(const Create_table_option_filter &) =
+      delete;
+  Create_table_option_filter &operator=(Create_table_option_filter &&) =
+      delete;
+
+  ~Create_table_option_filter() = default;
+
+  /**
+   * Sets the statement to be filtered, discards the results of previous
+   * calls.
+   *
+   * @param create_table CREATE TABLE statement.
+   */
+  void reset(std::string_view create_table);
+
+  /**
+   * See: check_create_table_for_data_index_dir_option().
+   *
+   * @param fix Whether DATA|INDEX DIRECTORY options should be commented out.
+   */
+  bool data_index_dir_option(bool fix);
+
+  /**
+   * See: check_create_table_for_encryption_option().
+   *
+   * @param fix Whether ENCRYPTION option should be commented out.
+   */
+  bool encryption_option(bool fix);
+
+  /**
+   * See: check_create_table_for_engine_option().
+   *
+   * @param fix Whether engine should be replaced with the target one.
+   */
+  std::string engine_option(bool fix, const std::string &target = "InnoDB");
+
+  /**
+   * See: check_create_table_for_fixed_row_format().
+   *
+   * @param fix Whether ROW_FORMAT=FIXED option should be removed.
+   */
+  bool fixed_row_format(bool fix);
+
+  /**
+   * See: check_create_table_for_tablespace_option().
+   *
+   * @param fix Whether the TABLESPACE option should be removed.
+   */
+  bool tablespace_option(
+      bool fix, const std::vector<std::string> &whitelist = {"innodb_"});
+
+  /**
+   * @returns statement with the fixes applied so far, valid until the next
+   *          call to reset()
+   */
+  const std::string &statement() const { return m_statement; }
+
+ private:
+  bool contains(std::string_view keyword) const;
+
+  void validate(bool skip_quoted);
+
+  void update(std::string &&rewritten);
+
+  std::string m_statement;
+  // lower case copy of the original statement and of the text inserted by
+  // the filters
+  std::string m_keywords;
+  std::string m_rewritten;
+  // whether statement was validated by an iterator which skips quoted strings
+  // or not
+  bool m_validated[2] = {false, false};
+};
+
 std::vector<std::string> check_statement_for_charset_option(
     const std::string &statement, std::string *rewritten = nullptr,
     const std::vector<std::string> &whitelist = {"utf8mb4"});
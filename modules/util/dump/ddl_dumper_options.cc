@@ -70,7 +70,10 @@ const shcore::Option_pack_def<Ddl_dumper_options>
           .include<Dump_options>()
           .optional("chunking", &Ddl_dumper_options::m_split)
           .optional("bytesPerChunk", &Ddl_dumper_options::set_bytes_per_chunk)
+          .optional("adaptiveChunking",
+                    &Ddl_dumper_options::m_adaptive_chunking)
           .optional("threads", &Ddl_dumper_options::set_threads)
+          .optional("ddlThreads", &Ddl_dumper_options::m_ddl_threads)
           .optional("triggers", &Ddl_dumper_options::m_dump_triggers)
           .optional("tzUtc", &Ddl_dumper_options::m_timezone_utc)
           .optional("ddlOnly", &Ddl_dumper_options::m_ddl_only)
@@ -57,10 +57,18 @@ class Ddl_dumper_options : public Dump_options {
 
   uint64_t bytes_per_chunk() const override { return m_bytes_per_chunk; }
 
+  bool adaptive_chunking() const override {
+    return m_split && m_adaptive_chunking;
+  }
+
   std::size_t threads() const override { return m_threads; }
 
   std::size_t worker_threads() const override { return m_worker_threads; }
 
+  std::size_t ddl_threads() const override {
+    return dump_ddl() ? m_ddl_threads : 0;
+  }
+
   bool is_export_only() const override { return false; }
 
   bool use_single_file() const override { return false; }
@@ -113,6 +121,7 @@ class Ddl_dumper_options : public Dump_options {
 
   bool m_split = true;
   uint64_t m_bytes_per_chunk;
+  bool m_adaptive_chunking = false;
 
   // Number of threads requested by the user (or default)
   // At most this number of database connections will be used in the dump
@@ -122,6 +131,10 @@ class Ddl_dumper_options : public Dump_options {
   // Internal number of threads (to be doubled in the case of prefix PAR dumps)
   uint64_t m_worker_threads = 4;
 
+  // Number of threads (and database connections) used to dump the DDL, in
+  // addition to the ones above
+  uint64_t m_ddl_threads = 0;
+
   bool m_dump_triggers = true;
   bool m_timezone_utc = true;
   bool m_ddl_only = false;
@@ -42,7 +42,6 @@
 #include "mysqlshdk/libs/db/mysql/result.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
-#include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -212,34 +211,8 @@ void Dump_options::set_where_clause(const std::string &schema,
     return;
   }
 
-  // prevent SQL injection
-  mysqlshdk::utils::SQL_iterator it{where};
-  int parentheses = 0;
-
-  const auto throw_error = [&schema, &table, &where]() {
-    throw std::invalid_argument("Malformed condition used for table '" +
-                                schema + "'.'" + table + "': " + where);
-  };
-
-  while (it.valid()) {
-    const auto token = it.next_token();
-
-    if (shcore::str_caseeq("(", token)) {
-      ++parentheses;
-    } else if (shcore::str_caseeq(")", token)) {
-      --parentheses;
-
-      if (parentheses < 0) {
-        throw_error();
-      }
-    }
-  }
-
-  if (parentheses != 0) {
-    throw_error();
-  }
-
-  m_where[schema][table] = '(' + where + ')';
+  m_where[schema][table] =
+      dump::common::validate_where_clause(schema, table, where);
 }
 
 void Dump_options::set_partitions(
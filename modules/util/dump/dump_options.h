@@ -161,10 +161,22 @@ class Dump_options {
 
   virtual uint64_t bytes_per_chunk() const = 0;
 
+  /**
+   * Whether number of rows in chunks is adjusted using the sizes of chunks of
+   * the same table which were already written.
+   */
+  virtual bool adaptive_chunking() const { return false; }
+
   virtual std::size_t threads() const = 0;
 
   virtual std::size_t worker_threads() const { return threads(); }
 
+  /**
+   * Number of additional threads (and sessions) dedicated to dumping the DDL,
+   * if 0, DDL is dumped by the regular workers.
+   */
+  virtual std::size_t ddl_threads() const { return 0; }
+
   virtual bool is_export_only() const = 0;
 
   virtual bool use_single_file() const = 0;
@@ -34,6 +34,7 @@
 #include <list>
 #include <set>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 
 #include <mysqld_error.h>
@@ -49,6 +50,7 @@
 #include "mysqlshdk/libs/db/utils/utils.h"
 #include "mysqlshdk/libs/mysql/binlog_utils.h"
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
+#include "mysqlshdk/libs/rest/rest_service.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/utils.h"
@@ -96,6 +98,12 @@ namespace {
 static constexpr const int k_mysql_server_net_write_timeout = 30 * 60;
 static constexpr const int k_mysql_server_wait_timeout = 365 * 24 * 60 * 60;
 
+// maximum number of tables and views handled by a single DDL task
+constexpr std::size_t k_max_ddl_batch_size = 32;
+
+// size of the buffer used when merging parts of the output file
+constexpr std::size_t k_merge_buffer_size = 4 * 1024 * 1024;
+
 FI_DEFINE(dumper, [](const mysqlshdk::utils::FI::Args &args) {
   const auto op = args.get_string("op");
 
@@ -125,12 +133,13 @@ std::string to_string(rapidjson::Document *doc) {
   return std::string{buffer.GetString(), buffer.GetSize()};
 }
 
-void write_json(std::unique_ptr<mysqlshdk::storage::IFile> file,
-                rapidjson::Document *doc) {
-  const auto json = to_string(doc);
+std::string write_json(std::unique_ptr<mysqlshdk::storage::IFile> file,
+                       rapidjson::Document *doc) {
+  auto json = to_string(doc);
   file->open(Mode::WRITE);
   file->write(json.c_str(), json.length());
   file->close();
+  return json;
 }
 
 issues::Status_set show_issues(
@@ -433,9 +442,9 @@ class Dumper::Dump_writer_controller {
     return update_stats(result);
   }
 
-  virtual void update_uncompressed_file_size(
-      std::unordered_map<std::string, uint64_t> *stats) const {
-    (*stats)[output_filename()] += m_total_written.data_bytes();
+  virtual void update_file_stats(
+      std::unordered_map<std::string, Dump_write_result> *stats) const {
+    (*stats)[output_filename()] += m_total_written;
   }
 
  protected:
@@ -627,10 +636,10 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
     return result;
   }
 
-  void update_uncompressed_file_size(
-      std::unordered_map<std::string, uint64_t> *stats) const override {
+  void update_file_stats(std::unordered_map<std::string, Dump_write_result>
+                             *stats) const override {
     for (const auto &file : m_file_stats) {
-      (*stats)[file.first] += file.second.data_bytes();
+      (*stats)[file.first] += file.second;
     }
   }
 
@@ -675,11 +684,14 @@ class Dumper::Table_worker final {
 
   Table_worker() = delete;
 
-  Table_worker(std::size_t id, Dumper *dumper, Exception_strategy strategy)
+  Table_worker(std::size_t id, Dumper *dumper, Exception_strategy strategy,
+               Task_queue *tasks, Session_pool *sessions)
       : m_id(id),
         m_log_id(shcore::str_format("[Worker%03zu]: ", m_id)),
         m_dumper(dumper),
-        m_strategy(strategy) {}
+        m_strategy(strategy),
+        m_tasks(tasks),
+        m_sessions(sessions) {}
 
   Table_worker(const Table_worker &) = delete;
   Table_worker(Table_worker &&) = default;
@@ -691,7 +703,7 @@ class Dumper::Table_worker final {
 
   void release_session() {
     if (m_session) {
-      m_dumper->session_pool().push(std::move(m_session));
+      m_sessions->push(std::move(m_session));
     }
   }
 
@@ -705,7 +717,7 @@ class Dumper::Table_worker final {
 
       mysqlsh::Mysql_thread mysql_thread;
       while (true) {
-        auto work = m_dumper->m_worker_tasks.pop();
+        auto work = m_tasks->pop();
 
         if (m_dumper->m_worker_interrupt.test()) {
           return;
@@ -717,7 +729,7 @@ class Dumper::Table_worker final {
 
         context = std::move(work.info);
 
-        m_session = m_dumper->session_pool().pop();
+        m_session = m_sessions->pop();
         shcore::on_leave_scope session_releaser(
             [this]() { release_session(); });
 
@@ -865,8 +877,13 @@ class Dumper::Table_worker final {
              controller->total_stats().rows_written(),
              controller->total_stats().data_bytes(), controller->longest_row());
 
+    if (table.chunk_stats) {
+      table.chunk_stats->rows += controller->total_stats().rows_written();
+      table.chunk_stats->data_bytes += controller->total_stats().data_bytes();
+    }
+
     m_dumper->update_progress(controller->progress_stats());
-    m_dumper->finish_writing(table.schema, table.name, controller);
+    m_dumper->finish_writing(table);
     m_dumper->data_task_finished();
   }
 
@@ -883,6 +900,7 @@ class Dumper::Table_worker final {
     data_task.index = table.index;
     data_task.partitions = table.partitions;
     data_task.extra_filter = table.extra_filter;
+    data_task.chunk_stats = table.chunk_stats;
     data_task.chunk = chunk;
 
     if (!filename.empty()) {
@@ -915,13 +933,17 @@ class Dumper::Table_worker final {
   void create_and_push_table_data_chunk_task(const Table_task &table,
                                              const std::string &boundary,
                                              const std::string &id,
-                                             std::size_t idx, bool last_chunk) {
+                                             std::size_t idx, bool last_chunk,
+                                             Row range_begin = {},
+                                             Row range_end = {}) {
     Table_data_task data_task = create_table_data_task(
         table,
         m_dumper->get_table_data_filename(table.basename, idx, last_chunk),
         idx);
 
     data_task.id = "chunk " + id;
+    data_task.range_begin = std::move(range_begin);
+    data_task.range_end = std::move(range_end);
 
     if (!boundary.empty()) {
       data_task.boundary = "(" + boundary + ")";
@@ -982,6 +1004,8 @@ class Dumper::Table_worker final {
   }
 
   void create_table_data_tasks(const Table_task &table) {
+    m_chunking_continues = false;
+
     auto ranges = create_ranged_tasks(table);
 
     if (0 == ranges) {
@@ -989,11 +1013,17 @@ class Dumper::Table_worker final {
       ++ranges;
     }
 
+    if (!m_chunking_continues) {
+      log_ranges(table, ranges);
+    }
+
+    m_dumper->chunking_task_finished();
+  }
+
+  void log_ranges(const Table_task &table, std::size_t ranges) const {
     log_info("%sData dump for table %s will be written to %zu file%s",
              m_log_id.c_str(), table.task_name.c_str(), ranges,
              ranges > 1 ? "s" : "");
-
-    m_dumper->chunking_task_finished();
   }
 
   template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
@@ -1005,6 +1035,13 @@ class Dumper::Table_worker final {
     return '\'' + d.to_string() + '\'';
   }
 
+  template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  static std::string range_value(const T &v) {
+    return std::to_string(v);
+  }
+
+  static std::string range_value(const Decimal &d) { return d.to_string(); }
+
   template <typename T>
   static std::string between(const std::string &column, T begin, T end) {
     assert(begin <= end);
@@ -1087,6 +1124,28 @@ class Dumper::Table_worker final {
     return ge(info, begin) + "AND" + compare_le(info, end);
   }
 
+  static Row range_value(const Chunking_info &info, const Row &value) {
+    const auto &columns = info.table->index.info->columns();
+    Row result;
+
+    result.reserve(value.size());
+
+    for (std::size_t i = 0; i < value.size(); ++i) {
+      const auto type = columns[info.index_column + i]->type;
+
+      // binary values are stored as hex literals, so that they can be safely
+      // written to the JSON metadata
+      if (mysqlshdk::db::Type::Bytes == type ||
+          mysqlshdk::db::Type::Geometry == type) {
+        result.emplace_back(shcore::string_to_hex(value[i]));
+      } else {
+        result.emplace_back(value[i]);
+      }
+    }
+
+    return result;
+  }
+
   template <typename T>
   static std::string between(const Chunking_info &info, T begin, T end) {
     std::string result = info.boundary;
@@ -1170,6 +1229,11 @@ class Dumper::Table_worker final {
                : std::numeric_limits<T>::max();
   }
 
+  template <typename T>
+  static T scale(const T &value, uint64_t numerator, uint64_t denominator) {
+    return cast<T>(static_cast<long double>(value) * numerator / denominator);
+  }
+
   template <typename T>
   static T sum(const T &value, const T &addend) {
     // if sum is greater than max, use max instead
@@ -1277,11 +1341,80 @@ class Dumper::Table_worker final {
     return ensure_not_zero(middle - from);
   }
 
+  /**
+   * Adjusts the number of rows per chunk using the average size of rows which
+   * were already written by the chunks of the same table.
+   *
+   * @returns true if number of rows per chunk has changed
+   */
+  bool adjust_rows_per_chunk(Chunking_info *info) const {
+    // minimum number of rows which need to be written before the average row
+    // size is considered to be accurate
+    static constexpr uint64_t k_min_sample_rows = 1000;
+
+    const auto &stats = info->table->chunk_stats;
+
+    if (!stats) {
+      return false;
+    }
+
+    const auto bytes_per_chunk = m_dumper->m_options.bytes_per_chunk();
+    const auto rows = stats->rows.load();
+    const auto data_bytes = stats->data_bytes.load();
+
+    if (!rows || !data_bytes ||
+        (rows < k_min_sample_rows && data_bytes < bytes_per_chunk)) {
+      return false;
+    }
+
+    const auto rows_per_chunk = std::max(
+        static_cast<uint64_t>(static_cast<double>(bytes_per_chunk) * rows /
+                              data_bytes),
+        UINT64_C(1));
+    const auto difference = rows_per_chunk > info->rows_per_chunk
+                                ? rows_per_chunk - info->rows_per_chunk
+                                : info->rows_per_chunk - rows_per_chunk;
+
+    // ignore small changes, chunk is then within 10% of the expected size
+    if (difference <= info->rows_per_chunk / 10) {
+      return false;
+    }
+
+    log_info("%sAdjusting rows per chunk of %s from %" PRIu64 " to %" PRIu64
+             ", average row length of written data: %" PRIu64,
+             m_log_id.c_str(), info->table->task_name.c_str(),
+             info->rows_per_chunk, rows_per_chunk, data_bytes / rows);
+
+    info->rows_per_chunk = rows_per_chunk;
+    info->accuracy = std::max(info->rows_per_chunk / 10, UINT64_C(10));
+
+    return true;
+  }
+
+  /**
+   * State of the integer-based chunking of a table. If adaptive chunking is
+   * enabled, ranges are created in batches, and the next batch is created once
+   * the data tasks of the previous one were picked up, so that the size of the
+   * already written chunks can be used to adjust the remaining ones.
+   */
   template <typename T>
-  std::size_t chunk_integer_column(const Chunking_info &info, const T &min,
-                                   const T &max) {
+  struct Integer_chunking {
+    // copy of the table, set when chunking continues in another task
+    std::shared_ptr<Table_task> table;
+    Chunking_info info;
+    // rows per chunk can be adjusted while chunking
+    Chunking_info adjusted;
+    T current;
+    T max;
+    T estimated_step;
+    T step;
+    bool use_constant_step;
     std::size_t ranges_count = 0;
+  };
 
+  template <typename T>
+  std::size_t chunk_integer_column(const Chunking_info &info, const T &min,
+                                   const T &max) {
     // if rows_per_chunk <= 1 it may mean that the rows are bigger than chunk
     // size, which means we # chunks ~= # rows
     const auto estimated_chunks =
@@ -1292,6 +1425,7 @@ class Dumper::Table_worker final {
     using step_t = std::remove_cvref_t<decltype(min)>;
     const auto index_range = distance(min, max);
     const auto row_count_accuracy = std::max(info.row_count / 10, UINT64_C(1));
+
     const auto estimated_step =
         cast<step_t>(ensure_not_zero(index_range / estimated_chunks));
     // use constant step if number of chunks is small or index range is close to
@@ -1302,52 +1436,98 @@ class Dumper::Table_worker final {
              ? index_range - info.row_count
              : info.row_count - index_range) <= row_count_accuracy;
 
-    std::string chunk_id;
-    const auto next_step =
-        use_constant_step
-            ? std::function<step_t(const step_t &, const step_t &)>(
-                  constant_step<T>)
-            // using the default capture [&] below results in problems with
-            // GCC 5.4.0 (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=80543)
-            : [&info, &max, &chunk_id, this](const auto &from,
-                                             const auto &step) {
-                return this->adaptive_step(from, step, max, info, chunk_id);
-              };
-
-    auto current = min;
-    const auto step = estimated_step;
+    const auto state = std::make_shared<Integer_chunking<step_t>>(
+        Integer_chunking<step_t>{{},
+                                 info,
+                                 info,
+                                 min,
+                                 max,
+                                 estimated_step,
+                                 estimated_step,
+                                 use_constant_step});
 
     log_info("%sChunking %s using integer algorithm with %s step",
              m_log_id.c_str(), info.table->task_name.c_str(),
              use_constant_step ? "constant" : "adaptive");
 
+    return chunk_integer_range(state);
+  }
+
+  template <typename T>
+  std::size_t chunk_integer_range(
+      const std::shared_ptr<Integer_chunking<T>> &state) {
+    auto &s = *state;
+    const auto &info = s.info;
+    // ranges are created in batches only if adaptive chunking is enabled
+    const std::size_t batch_size =
+        info.table->chunk_stats ? m_dumper->m_options.threads() : 0;
+    std::size_t batch = 0;
     bool last_chunk = false;
 
     while (!last_chunk) {
       if (m_dumper->m_worker_interrupt.test()) {
-        return ranges_count;
+        return s.ranges_count;
       }
 
-      chunk_id = std::to_string(ranges_count);
-      const auto begin = current;
-      auto new_step = next_step(current, step);
+      if (batch_size && batch_size == batch) {
+        continue_chunking(state);
+        return s.ranges_count;
+      }
+
+      if (adjust_rows_per_chunk(&s.adjusted)) {
+        s.step = ensure_not_zero(
+            scale(s.estimated_step, s.adjusted.rows_per_chunk,
+                  std::max(info.rows_per_chunk, UINT64_C(1))));
+      }
+
+      const auto chunk_id = std::to_string(s.ranges_count);
+      const auto begin = s.current;
+      auto new_step =
+          s.use_constant_step
+              ? constant_step(s.current, s.step)
+              : adaptive_step(s.current, s.step, s.max, s.adjusted, chunk_id);
 
       // ensure that there's no integer overflow
       --new_step;
-      current = (current > max - new_step ? max : current + new_step);
+      s.current = (s.current > s.max - new_step ? s.max : s.current + new_step);
 
-      const auto end = current;
+      const auto end = s.current;
 
-      last_chunk = (current >= max);
+      last_chunk = (s.current >= s.max);
 
-      create_and_push_table_data_chunk_task(*info.table,
-                                            between(info, begin, end), chunk_id,
-                                            ranges_count++, last_chunk);
+      create_and_push_table_data_chunk_task(
+          *info.table, between(info, begin, end), chunk_id, s.ranges_count++,
+          last_chunk, {range_value(begin)}, {range_value(end)});
 
-      ++current;
+      ++s.current;
+      ++batch;
     }
 
-    return ranges_count;
+    return s.ranges_count;
+  }
+
+  template <typename T>
+  void continue_chunking(const std::shared_ptr<Integer_chunking<T>> &state) {
+    if (!state->table) {
+      // the original table task is destroyed once it's finished
+      state->table = std::make_shared<Table_task>(*state->info.table);
+      state->info.table = state->table.get();
+      state->adjusted.table = state->table.get();
+    }
+
+    m_chunking_continues = true;
+    m_dumper->push_table_chunking_task(
+        *state->table, [state](Table_worker *worker) {
+          worker->m_chunking_continues = false;
+
+          const auto ranges = worker->chunk_integer_range(state);
+
+          if (!worker->m_chunking_continues) {
+            worker->log_ranges(*state->table, ranges);
+          }
+
+          worker->m_dumper->chunking_task_finished();
+        });
   }
 
   std::size_t chunk_integer_column(const Chunking_info &info, const Row &begin,
@@ -1393,9 +1573,12 @@ class Dumper::Table_worker final {
 
     const auto select = "SELECT SQL_NO_CACHE " + index + " FROM " +
                         info.table->quoted_name + info.partition + " ";
-    const auto order_by_and_limit = info.order_by + " LIMIT " +
-                                    std::to_string(info.rows_per_chunk - 1) +
-                                    ",2 ";
+    // rows per chunk can be adjusted while chunking
+    Chunking_info adjusted = info;
+    const auto order_by_and_limit = [&adjusted]() {
+      return adjusted.order_by + " LIMIT " +
+             std::to_string(adjusted.rows_per_chunk - 1) + ",2 ";
+    };
 
     const auto fetch =
         [&end](const std::shared_ptr<mysqlshdk::db::IResult> &res) {
@@ -1410,7 +1593,8 @@ class Dumper::Table_worker final {
       const auto chunk_id = std::to_string(ranges_count);
       const auto comment = get_query_comment(*info.table, chunk_id);
 
-      result = query(select + condition + order_by_and_limit + comment);
+      adjust_rows_per_chunk(&adjusted);
+      result = query(select + condition + order_by_and_limit() + comment);
 
       if (m_dumper->m_worker_interrupt.test()) {
         return 0;
@@ -1420,7 +1604,8 @@ class Dumper::Table_worker final {
 
       create_and_push_table_data_chunk_task(
           *info.table, between(info, range_begin, range_end), chunk_id,
-          ranges_count++, range_end == end);
+          ranges_count++, range_end == end, range_value(info, range_begin),
+          range_value(info, range_end));
 
       range_begin = fetch(result);
     } while (range_end != end);
@@ -1497,6 +1682,14 @@ class Dumper::Table_worker final {
       return 0;
     }
 
+    if (table.partitions.size() > 1) {
+      // exportTable() dumps all selected partitions using a single query, to
+      // preserve the order of rows
+      log_info("%sTable %s will not be chunked, multiple partitions selected",
+               m_log_id.c_str(), table.task_name.c_str());
+      return 0;
+    }
+
     mysqlshdk::utils::Duration duration;
     duration.start();
 
@@ -1610,48 +1803,57 @@ class Dumper::Table_worker final {
     m_dumper->validate_dump_consistency(m_session);
   }
 
-  void dump_table_ddl(const Schema_info &schema,
+  void dump_objects_ddl(const Schema_info &schema,
+                        const std::vector<const View_info *> &views,
+                        const std::vector<const Table_info *> &tables) const {
+    // all objects are dumped using the same dumper, session-level setup is
+    // done just once
+    const auto dumper = m_dumper->schema_dumper(m_session);
+
+    for (const auto view : views) {
+      dump_view_ddl(dumper.get(), schema, *view);
+    }
+
+    for (const auto table : tables) {
+      dump_table_ddl(dumper.get(), schema, *table);
+    }
+
+    m_dumper->validate_dump_consistency(m_session);
+  }
+
+  void dump_table_ddl(Schema_dumper *dumper, const Schema_info &schema,
                       const Table_info &table) const {
     log_info("%sWriting DDL for table %s", m_log_id.c_str(),
              table.quoted_name.c_str());
 
-    const auto dumper = m_dumper->schema_dumper(m_session);
-
-    m_dumper->write_ddl(
-        *m_dumper->dump_table(dumper.get(), schema.name, table.name),
-        common::get_table_filename(table.basename));
+    m_dumper->write_ddl(*m_dumper->dump_table(dumper, schema.name, table.name),
+                        common::get_table_filename(table.basename));
 
     if (m_dumper->m_options.dump_triggers() &&
         dumper->count_triggers_for_table(schema.name, table.name) > 0) {
       m_dumper->write_ddl(
-          *m_dumper->dump_triggers(dumper.get(), schema.name, table.name),
+          *m_dumper->dump_triggers(dumper, schema.name, table.name),
           common::get_table_data_filename(table.basename, "triggers.sql"));
     }
 
     ++m_dumper->m_ddl_written;
-
-    m_dumper->validate_dump_consistency(m_session);
   }
 
-  void dump_view_ddl(const Schema_info &schema, const View_info &view) const {
+  void dump_view_ddl(Schema_dumper *dumper, const Schema_info &schema,
+                     const View_info &view) const {
     log_info("%sWriting DDL for view %s", m_log_id.c_str(),
              view.quoted_name.c_str());
 
-    const auto dumper = m_dumper->schema_dumper(m_session);
-
     // DDL file with the temporary table
     m_dumper->write_ddl(
-        *m_dumper->dump_temporary_view(dumper.get(), schema.name, view.name),
+        *m_dumper->dump_temporary_view(dumper, schema.name, view.name),
         common::get_table_data_filename(view.basename, "pre.sql"));
 
     // DDL file with the view structure
-    m_dumper->write_ddl(
-        *m_dumper->dump_view(dumper.get(), schema.name, view.name),
-        common::get_table_filename(view.basename));
+    m_dumper->write_ddl(*m_dumper->dump_view(dumper, schema.name, view.name),
+                        common::get_table_filename(view.basename));
 
     ++m_dumper->m_ddl_written;
-
-    m_dumper->validate_dump_consistency(m_session);
   }
 
   std::string get_query_comment(const Table_task &table,
@@ -1663,7 +1865,11 @@ class Dumper::Table_worker final {
   const std::string m_log_id;
   Dumper *m_dumper;
   Exception_strategy m_strategy;
+  Task_queue *m_tasks;
+  Session_pool *m_sessions;
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
+  // set if chunking of the current table continues in another task
+  bool m_chunking_continues = false;
 };
 
 // template specialization of a static method must be defined outside of a class
@@ -1677,6 +1883,12 @@ Decimal Dumper::Table_worker::sum(const Decimal &value, const Decimal &delta) {
   return value + delta;
 }
 
+template <>
+Decimal Dumper::Table_worker::scale(const Decimal &value, uint64_t numerator,
+                                    uint64_t denominator) {
+  return value * shcore::Bignum{numerator} / shcore::Bignum{denominator};
+}
+
 class Dumper::Memory_dumper final {
  public:
   Memory_dumper() = delete;
@@ -1857,6 +2069,8 @@ void Dumper::run() {
         "created.");
   }
 
+  m_transport_stats = mysqlshdk::rest::transport_stats();
+
   try {
     do_run();
   } catch (...) {
@@ -1982,16 +2196,8 @@ void Dumper::do_run() {
 
     shcore::on_leave_scope cleanup([this]() {
       // Ensures all the worker sessions get closed
-      size_t worker_sessions = m_options.threads();
-      while (worker_sessions) {
-        auto session = m_session_pool.pop();
-
-        if (!m_worker_exception_thrown) {
-          assert_transaction_is_open(session);
-        }
-        session->close();
-        --worker_sessions;
-      }
+      close_worker_sessions(&m_session_pool, m_options.threads());
+      close_worker_sessions(&m_ddl_session_pool, m_options.ddl_threads());
     });
 
     create_schema_tasks();
@@ -2006,6 +2212,9 @@ void Dumper::do_run() {
 
     create_schema_metadata_tasks();
     create_schema_ddl_tasks();
+    // DDL workers exit once they process all their tasks
+    m_ddl_tasks.shutdown(m_ddl_workers.size());
+
     create_table_tasks();
 
     if (!m_worker_interrupt.test()) {
@@ -2888,6 +3097,11 @@ void Dumper::initialize_dump() {
 
   create_output_directory();
   write_metadata();
+
+  if (!m_options.is_export_only()) {
+    m_manifest =
+        std::make_unique<common::Dump_manifest_writer>(m_options.compression());
+  }
 }
 
 void Dumper::finalize_dump() {
@@ -2895,6 +3109,8 @@ void Dumper::finalize_dump() {
     return;
   }
 
+  merge_output_parts();
+  write_manifest();
   write_checksum_metadata();
   write_dump_finished_metadata();
   close_output_directory();
@@ -2924,27 +3140,61 @@ void Dumper::close_output_directory() {
 }
 
 void Dumper::create_worker_sessions() {
-  for (std::size_t i = 0; i < m_options.threads(); ++i) {
-    auto worker_session =
-        establish_session(session()->get_connection_options(), false);
+  const auto create_sessions = [this](std::size_t count, Session_pool *pool) {
+    for (std::size_t i = 0; i < count; ++i) {
+      auto worker_session =
+          establish_session(session()->get_connection_options(), false);
 
-    start_transaction(worker_session);
-    on_init_thread_session(worker_session);
+      start_transaction(worker_session);
+      on_init_thread_session(worker_session);
 
-    m_session_pool.push(std::move(worker_session));
-  }
+      pool->push(std::move(worker_session));
+    }
+  };
+
+  create_sessions(m_options.threads(), &m_session_pool);
+  // DDL sessions also need to be created while read locks are held, so that
+  // they see the same snapshot as the rest of the workers
+  create_sessions(m_options.ddl_threads(), &m_ddl_session_pool);
 }
 
 void Dumper::create_worker_threads() {
+  const auto worker_threads = m_options.worker_threads();
+  const auto ddl_threads = m_options.ddl_threads();
+
   m_worker_exceptions.clear();
-  m_worker_exceptions.resize(m_options.worker_threads());
+  m_worker_exceptions.resize(worker_threads + ddl_threads);
 
-  for (std::size_t i = 0; i < m_options.worker_threads(); ++i) {
+  for (std::size_t i = 0; i < worker_threads; ++i) {
     auto t = mysqlsh::spawn_scoped_thread(
         &Table_worker::run,
-        Table_worker{i, this, Table_worker::Exception_strategy::ABORT});
+        Table_worker{i, this, Table_worker::Exception_strategy::ABORT,
+                     &m_worker_tasks, &m_session_pool});
     m_workers.emplace_back(std::move(t));
   }
+
+  for (std::size_t i = 0; i < ddl_threads; ++i) {
+    auto t = mysqlsh::spawn_scoped_thread(
+        &Table_worker::run,
+        Table_worker{worker_threads + i, this,
+                     Table_worker::Exception_strategy::ABORT, &m_ddl_tasks,
+                     &m_ddl_session_pool});
+    m_ddl_workers.emplace_back(std::move(t));
+  }
+}
+
+void Dumper::close_worker_sessions(Session_pool *pool,
+                                   std::size_t count) const {
+  while (count) {
+    auto session = pool->pop();
+
+    if (!m_worker_exception_thrown) {
+      assert_transaction_is_open(session);
+    }
+
+    session->close();
+    --count;
+  }
 }
 
 void Dumper::maybe_push_shutdown_tasks() {
@@ -2987,6 +3237,10 @@ void Dumper::checksum_task_finished() {
 }
 
 void Dumper::wait_for_all_tasks() {
+  for (auto &worker : m_ddl_workers) {
+    worker.join();
+  }
+
   for (auto &worker : m_workers) {
     worker.join();
   }
@@ -2997,6 +3251,11 @@ void Dumper::wait_for_all_tasks() {
     m_output_file->close();
   }
 
+  if (m_worker_interrupt.test()) {
+    remove_output_parts();
+  }
+
+  m_ddl_workers.clear();
   m_workers.clear();
 }
 
@@ -3017,26 +3276,19 @@ void Dumper::dump_global_ddl() const {
   }
 
   const auto dumper = schema_dumper(session());
+  // files are written using write_ddl(), so that they are added to the
+  // manifest
+  const auto comment = [&dumper, this]() {
+    return dump_ddl(dumper.get(), [](Memory_dumper *m) {
+      m->dump(&Schema_dumper::write_comment, std::string{}, std::string{});
+    });
+  };
 
-  {
-    // file with the DDL setup
-    const auto output = make_file("@.sql");
-    output->open(Mode::WRITE);
-
-    dumper->write_comment(output.get());
-
-    output->close();
-  }
-
-  {
-    // post DDL file (cleanup)
-    const auto output = make_file("@.post.sql");
-    output->open(Mode::WRITE);
-
-    dumper->write_comment(output.get());
+  // file with the DDL setup
+  write_ddl(*comment(), "@.sql");
 
-    output->close();
-  }
+  // post DDL file (cleanup)
+  write_ddl(*comment(), "@.post.sql");
 }
 
 void Dumper::dump_users_ddl() const {
@@ -3075,6 +3327,8 @@ void Dumper::write_ddl(const Memory_dumper &in_memory,
   output->write(content.c_str(), content.length());
 
   output->close();
+
+  add_to_manifest(file, content);
 }
 
 std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_ddl(
@@ -3180,27 +3434,65 @@ void Dumper::create_schema_ddl_tasks() {
 
   m_progress_thread.start_stage("Writing DDL", std::move(config));
 
+  const auto ddl_threads = m_options.ddl_threads();
+  const auto threads = ddl_threads ? ddl_threads : m_options.worker_threads();
+  auto &tasks = ddl_threads ? m_ddl_tasks : m_worker_tasks;
+
   for (const auto &schema : m_schema_infos) {
-    m_worker_tasks.push(
+    tasks.push(
         {"writing DDL of " + schema.quoted_name,
          [&schema](Table_worker *worker) { worker->dump_schema_ddl(schema); }},
         shcore::Queue_priority::HIGH);
 
+    // objects are dumped in batches, to amortize the cost of setting up the
+    // session, while keeping all the workers busy
+    const auto objects = schema.views.size() + schema.tables.size();
+    const auto batch_size = std::clamp<std::size_t>(
+        (objects + threads - 1) / threads, 1, k_max_ddl_batch_size);
+    std::vector<const View_info *> views;
+    std::vector<const Table_info *> tables;
+
+    const auto push_batch = [&]() {
+      if (views.empty() && tables.empty()) {
+        return;
+      }
+
+      const auto &first = views.empty() ? tables.front()->quoted_name
+                                        : views.front()->quoted_name;
+      const auto count = views.size() + tables.size();
+
+      tasks.push(
+          {"writing DDL of " + first +
+               (count > 1 ? " and " + std::to_string(count - 1) +
+                                " other object(s)"
+                          : ""),
+           [&schema, views = std::move(views),
+            tables = std::move(tables)](Table_worker *worker) {
+             worker->dump_objects_ddl(schema, views, tables);
+           }},
+          shcore::Queue_priority::HIGH);
+
+      views.clear();
+      tables.clear();
+    };
+
     for (const auto &view : schema.views) {
-      m_worker_tasks.push({"writing DDL of " + view.quoted_name,
-                           [&schema, &view](Table_worker *worker) {
-                             worker->dump_view_ddl(schema, view);
-                           }},
-                          shcore::Queue_priority::HIGH);
+      views.emplace_back(&view);
+
+      if (views.size() == batch_size) {
+        push_batch();
+      }
     }
 
     for (const auto &table : schema.tables) {
-      m_worker_tasks.push({"writing DDL of " + table.quoted_name,
-                           [&schema, &table](Table_worker *worker) {
-                             worker->dump_table_ddl(schema, table);
-                           }},
-                          shcore::Queue_priority::HIGH);
+      tables.emplace_back(&table);
+
+      if (views.size() + tables.size() == batch_size) {
+        push_batch();
+      }
     }
+
+    push_batch();
   }
 }
 
@@ -3289,6 +3581,10 @@ Dumper::Table_task Dumper::create_table_task(const Schema_info &schema,
   task.partitions = table.partitions;
   task.extra_filter = m_options.where(schema.name, table.name);
 
+  if (m_options.adaptive_chunking()) {
+    task.chunk_stats = std::make_shared<Chunk_stats>();
+  }
+
   on_create_table_task(task.schema, task.name, task.info);
 
   return task;
@@ -3416,6 +3712,23 @@ void Dumper::push_table_data_task(Table_data_task &&task) {
                       shcore::Queue_priority::LOW);
 }
 
+void Dumper::push_table_chunking_task(
+    const Table_task &table, std::function<void(Table_worker *)> &&task) {
+  ++m_chunking_tasks_total;
+
+  std::string info = "chunking " + table.task_name;
+  // scheduled after the data tasks which were already created
+  m_worker_tasks.push({std::move(info),
+                       [task = std::move(task)](Table_worker *worker) {
+                         ++worker->m_dumper->m_num_threads_chunking;
+
+                         task(worker);
+
+                         --worker->m_dumper->m_num_threads_chunking;
+                       }},
+                      shcore::Queue_priority::LOW);
+}
+
 void Dumper::push_table_chunking_task(Table_task &&task) {
   ++m_chunking_tasks_total;
 
@@ -3485,8 +3798,8 @@ void Dumper::push_checksum_task(Checksum_task &&task) {
 }
 
 std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
-    const std::string &filename) const {
-  if (m_options.use_single_file()) {
+    const std::string &filename) {
+  if (m_options.use_single_file() && !m_options.split()) {
     return std::make_unique<Single_file_writer_controller>(m_writer_creator(),
                                                            m_output_file.get());
   } else {
@@ -3500,7 +3813,9 @@ std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
         m_options.write_index_files()
             ? [this](const std::string &name) { return make_file(name); }
             : Dump_writer_controller::Create_file{},
-        filename,
+        // when writing to a single file in parallel, chunks are written to
+        // separate files, which are merged once the whole table is dumped
+        m_options.use_single_file() ? add_output_part() : filename,
         // We only use the .dumping extension in case of the local files. In
         // case of the remote ones, file is not actually created until the whole
         // data is uploaded, so it's not visible to the loader. This allows to
@@ -3510,18 +3825,91 @@ std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
 }
 
 std::unique_ptr<Dumper::Dump_writer_controller>
-Dumper::table_dump_multi_file_controller(const std::string &basename) const {
+Dumper::table_dump_multi_file_controller(const std::string &basename) {
   return std::make_unique<Multi_file_writer_controller>(
       [this](const std::string &name) { return table_dump_controller(name); },
       basename, m_table_data_extension, m_options.bytes_per_chunk());
 }
 
-void Dumper::finish_writing(const std::string &schema, const std::string &table,
-                            const Dump_writer_controller *controller) {
+std::string Dumper::add_output_part() {
+  std::lock_guard lock{m_output_parts_mutex};
+
+  m_output_parts.emplace_back(shcore::str_format(
+      "%s.%zu.part", m_output_file->filename().c_str(), m_output_parts.size()));
+
+  return m_output_parts.back();
+}
+
+void Dumper::merge_output_parts() {
+  if (m_output_parts.empty()) {
+    return;
+  }
+
+  const auto stage = m_progress_thread.start_stage("Merging output files");
+  shcore::on_leave_scope finish_stage([stage]() { stage->finish(); });
+
+  log_info("Merging %zu parts into '%s'", m_output_parts.size(),
+           m_output_file->full_path().masked().c_str());
+
+  // each part is compressed separately, compressed streams can be concatenated,
+  // so raw contents of the files are copied
+  const auto output = make_file(m_output_file->filename());
+  std::string buffer;
+  buffer.resize(k_merge_buffer_size);
+
+  output->open(Mode::WRITE);
+
+  for (const auto &name : m_output_parts) {
+    const auto part = make_file(name);
+    ssize_t bytes;
+
+    part->open(Mode::READ);
+
+    while ((bytes = part->read(buffer.data(), buffer.size())) > 0) {
+      output->write(buffer.data(), bytes);
+    }
+
+    part->close();
+
+    if (bytes < 0) {
+      throw std::runtime_error("Failed to read the output file part: " +
+                               part->full_path().masked());
+    }
+  }
+
+  output->close();
+
+  remove_output_parts();
+}
+
+void Dumper::remove_output_parts() {
+  for (const auto &name : m_output_parts) {
+    try {
+      const auto part = make_file(name);
+
+      if (part->exists()) {
+        part->remove();
+      }
+    } catch (const std::exception &e) {
+      log_warning("Failed to remove the output file part '%s': %s",
+                  name.c_str(), e.what());
+    }
+  }
+
+  m_output_parts.clear();
+}
+
+void Dumper::finish_writing(const Table_data_task &task) {
+  const auto controller = task.controller.get();
   std::lock_guard<std::mutex> lock(m_table_data_stats_mutex);
 
-  controller->update_uncompressed_file_size(&m_chunk_file_bytes);
-  m_table_data_stats[schema][table] += controller->total_stats();
+  controller->update_file_stats(&m_chunk_file_stats);
+  m_table_data_stats[task.schema][task.name] += controller->total_stats();
+
+  if (!task.range_begin.empty()) {
+    m_chunk_ranges.emplace(controller->output_filename(),
+                           std::make_pair(task.range_begin, task.range_end));
+  }
 }
 
 void Dumper::write_metadata() const {
@@ -3700,17 +4088,75 @@ void Dumper::write_dump_finished_metadata() const {
   }
 
   {
-    Value files{Type::kObjectType};
+    Value bytes{Type::kObjectType};
+    Value rows{Type::kObjectType};
+
+    for (const auto &file : m_chunk_file_stats) {
+      bytes.AddMember(refs(file.first), file.second.data_bytes(), a);
+      rows.AddMember(refs(file.first), file.second.rows_written(), a);
+    }
+
+    doc.AddMember(StringRef("chunkFileBytes"), std::move(bytes), a);
+    doc.AddMember(StringRef("chunkFileRows"), std::move(rows), a);
+  }
+
+  {
+    const auto to_array = [&a](const std::vector<std::string> &values) {
+      Value array{Type::kArrayType};
+
+      for (const auto &v : values) {
+        array.PushBack(refs(v), a);
+      }
+
+      return array;
+    };
 
-    for (const auto &file : m_chunk_file_bytes)
-      files.AddMember(refs(file.first), file.second, a);
+    Value ranges{Type::kObjectType};
 
-    doc.AddMember(StringRef("chunkFileBytes"), std::move(files), a);
+    for (const auto &file : m_chunk_ranges) {
+      Value range{Type::kObjectType};
+
+      range.AddMember(StringRef("begin"), to_array(file.second.first), a);
+      range.AddMember(StringRef("end"), to_array(file.second.second), a);
+
+      ranges.AddMember(refs(file.first), std::move(range), a);
+    }
+
+    doc.AddMember(StringRef("chunkRanges"), std::move(ranges), a);
   }
 
   write_json(make_file("@.done.json"), &doc);
 }
 
+void Dumper::write_manifest() const {
+  if (!m_manifest) {
+    return;
+  }
+
+  std::unordered_set<mysqlshdk::storage::IDirectory::File_info> files;
+
+  try {
+    // version of each file is recorded, so that loader can detect the ones
+    // which were modified after the dump was created
+    files = directory()->list_files();
+  } catch (const std::exception &e) {
+    log_warning("Failed to list the dump files, manifest is not going to be "
+                "written: %s",
+                e.what());
+    return;
+  }
+
+  m_manifest->write(files,
+                    make_file(std::string{common::k_dump_manifest_file}));
+}
+
+void Dumper::add_to_manifest(const std::string &filename,
+                             std::string_view contents) const {
+  if (m_manifest) {
+    m_manifest->add(filename, contents);
+  }
+}
+
 void Dumper::write_checksum_metadata() const {
   if (!m_checksum) {
     return;
@@ -3813,8 +4259,8 @@ void Dumper::write_schema_metadata(const Schema_info &schema) const {
     doc.AddMember(StringRef("basenames"), std::move(basenames), a);
   }
 
-  write_json(make_file(common::get_schema_filename(schema.basename, "json")),
-             &doc);
+  const auto filename = common::get_schema_filename(schema.basename, "json");
+  add_to_manifest(filename, write_json(make_file(filename), &doc));
 }
 
 void Dumper::write_table_metadata(
@@ -3960,13 +4406,19 @@ void Dumper::write_table_metadata(
     }
   }
 
-  write_json(make_file(common::get_table_data_filename(table.basename, "json")),
-             &doc);
+  const auto filename =
+      common::get_table_data_filename(table.basename, "json");
+  add_to_manifest(filename, write_json(make_file(filename), &doc));
 }
 
 void Dumper::summarize() const {
   const auto console = current_console();
 
+  if (const auto stats = mysqlshdk::rest::transport_stats() - m_transport_stats;
+      stats.requests) {
+    log_info("REST transport: %s", stats.to_string().c_str());
+  }
+
   if (!m_options.consistent_dump() && m_options.threads() > 1) {
     const auto gtid_executed = schema_dumper(session())->gtid_executed(true);
 
@@ -4043,6 +4495,10 @@ void Dumper::emergency_shutdown() {
   if (const auto workers = m_workers.size()) {
     m_worker_tasks.shutdown(workers);
   }
+
+  if (const auto workers = m_ddl_workers.size()) {
+    m_ddl_tasks.shutdown(workers);
+  }
 }
 
 void Dumper::kill_workers() {
@@ -43,6 +43,7 @@
 
 #include "mysqlshdk/libs/db/column.h"
 #include "mysqlshdk/libs/mysql/user_privileges.h"
+#include "mysqlshdk/libs/rest/rest_service.h"
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -53,6 +54,7 @@
 #include "mysqlshdk/libs/utils/version.h"
 
 #include "modules/util/common/dump/checksums.h"
+#include "modules/util/common/dump/dump_manifest.h"
 #include "modules/util/dump/capability.h"
 #include "modules/util/dump/dump_options.h"
 #include "modules/util/dump/dump_writer.h"
@@ -181,11 +183,21 @@ class Dumper {
     std::vector<View_info> views;
   };
 
+  /**
+   * Amount of data written by the chunks of a single table.
+   */
+  struct Chunk_stats {
+    std::atomic<uint64_t> rows{0};
+    std::atomic<uint64_t> data_bytes{0};
+  };
+
   struct Table_task : Table_info {
     std::string task_name;
     std::string schema;
     std::string extra_filter;
     Index_info index;
+    // set if adaptive chunking is enabled
+    std::shared_ptr<Chunk_stats> chunk_stats;
   };
 
   struct Table_data_task : Table_task {
@@ -193,6 +205,10 @@ class Dumper {
     std::string id;
     int64_t chunk;
     std::string boundary;
+    // values of the index columns which delimit this chunk, empty if chunk is
+    // not a range of the index; rows with NULLs are not covered by the range
+    std::vector<std::string> range_begin;
+    std::vector<std::string> range_end;
   };
 
   struct Checksum_task {
@@ -208,6 +224,11 @@ class Dumper {
     std::function<void(Table_worker *)> task;
   };
 
+  using Task_queue = shcore::Synchronized_queue<Task_info>;
+
+  using Session_pool =
+      shcore::Synchronized_queue<std::shared_ptr<mysqlshdk::db::ISession>>;
+
   class Dump_info;
 
   class Memory_dumper;
@@ -277,6 +298,8 @@ class Dumper {
 
   void create_worker_threads();
 
+  void close_worker_sessions(Session_pool *pool, std::size_t count) const;
+
   void maybe_push_shutdown_tasks();
 
   void chunking_task_finished();
@@ -338,6 +361,12 @@ class Dumper {
 
   void push_table_chunking_task(Table_task &&task);
 
+  /**
+   * Continues chunking of the given table in a low priority task.
+   */
+  void push_table_chunking_task(const Table_task &table,
+                                std::function<void(Table_worker *)> &&task);
+
   void push_table_data_task(Table_data_task &&task);
 
   Checksum_task create_checksum_task(const Table_data_task &table);
@@ -349,13 +378,24 @@ class Dumper {
   bool should_dump_data(const Table_task &table) const;
 
   std::unique_ptr<Dump_writer_controller> table_dump_controller(
-      const std::string &filename) const;
+      const std::string &filename);
 
   std::unique_ptr<Dump_writer_controller> table_dump_multi_file_controller(
-      const std::string &basename) const;
+      const std::string &basename);
+
+  /**
+   * Registers a new part of the single output file, parts are merged in the
+   * order in which they were added.
+   *
+   * @returns name of the file which holds the new part
+   */
+  std::string add_output_part();
+
+  void merge_output_parts();
 
-  void finish_writing(const std::string &schema, const std::string &table,
-                      const Dump_writer_controller *controller);
+  void remove_output_parts();
+
+  void finish_writing(const Table_data_task &task);
 
   void write_metadata() const;
 
@@ -365,6 +405,11 @@ class Dumper {
 
   void write_checksum_metadata() const;
 
+  void write_manifest() const;
+
+  void add_to_manifest(const std::string &filename,
+                       std::string_view contents) const;
+
   void write_schema_metadata(const Schema_info &schema) const;
 
   void write_table_metadata(
@@ -431,11 +476,6 @@ class Dumper {
 
   void throw_if_cannot_dump_users() const;
 
-  shcore::Synchronized_queue<std::shared_ptr<mysqlshdk::db::ISession>>
-      &session_pool() {
-    return m_session_pool;
-  }
-
   bool all_tasks_produced() const;
 
   // session
@@ -456,6 +496,8 @@ class Dumper {
   const Dump_options &m_options;
   std::unique_ptr<mysqlshdk::storage::IDirectory> m_output_dir;
   std::unique_ptr<mysqlshdk::storage::IFile> m_output_file;
+  std::mutex m_output_parts_mutex;
+  std::vector<std::string> m_output_parts;
   Instance_cache m_cache;
   std::vector<Schema_info> m_schema_infos;
   std::unordered_map<std::string, std::size_t> m_truncated_basenames;
@@ -493,20 +535,31 @@ class Dumper {
   std::unique_ptr<mysqlshdk::textui::Throughput> m_data_throughput;
   std::unique_ptr<mysqlshdk::textui::Throughput> m_bytes_throughput;
 
+  // REST transport statistics when the dump started
+  mysqlshdk::rest::Transport_stats m_transport_stats;
+
   std::mutex m_table_data_stats_mutex;
   // schema -> table -> data stats
   std::unordered_map<std::string,
                      std::unordered_map<std::string, Dump_write_result>>
       m_table_data_stats;
 
-  // path -> uncompressed bytes
-  std::unordered_map<std::string, uint64_t> m_chunk_file_bytes;
+  // path -> data stats
+  std::unordered_map<std::string, Dump_write_result> m_chunk_file_stats;
+
+  // path -> first and last value of the index
+  std::unordered_map<std::string, std::pair<std::vector<std::string>,
+                                            std::vector<std::string>>>
+      m_chunk_ranges;
 
   // threads
   std::vector<std::thread> m_workers;
   std::vector<std::exception_ptr> m_worker_exceptions;
   std::atomic<bool> m_worker_exception_thrown = false;
-  shcore::Synchronized_queue<Task_info> m_worker_tasks;
+  Task_queue m_worker_tasks;
+  // DDL is dumped by a dedicated set of workers, if requested by the user
+  std::vector<std::thread> m_ddl_workers;
+  Task_queue m_ddl_tasks;
   std::atomic<uint64_t> m_chunking_tasks_total;
   std::atomic<uint64_t> m_chunking_tasks_completed;
   std::atomic<uint64_t> m_data_tasks_total;
@@ -525,11 +578,14 @@ class Dumper {
   mutable Progress_thread m_progress_thread;
   Progress_thread::Stage *m_data_dump_stage = nullptr;
 
-  shcore::Synchronized_queue<std::shared_ptr<mysqlshdk::db::ISession>>
-      m_session_pool;
+  Session_pool m_session_pool;
+  Session_pool m_ddl_session_pool;
 
   std::mutex m_checksums_mutex;
   std::unique_ptr<common::Checksums> m_checksum;
+
+  // copy of metadata files and DDL scripts, written at the end of the dump
+  std::unique_ptr<common::Dump_manifest_writer> m_manifest;
 };
 
 }  // namespace dump
@@ -25,18 +25,33 @@
 
 #include "modules/util/dump/export_table_options.h"
 
+#include <stdexcept>
+#include <string>
+
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/libs/db/mysql/result.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 
 namespace mysqlsh {
 namespace dump {
 
+using mysqlshdk::utils::expand_to_bytes;
+
+namespace {
+
+constexpr auto k_minimum_chunk_size = "128k";
+
+constexpr auto k_default_chunk_size = "64M";
+
+}  // namespace
+
 Export_table_options::Export_table_options()
     : m_blob_storage_options{
-          mysqlshdk::azure::Blob_storage_options::Operation::WRITE} {
+          mysqlshdk::azure::Blob_storage_options::Operation::WRITE},
+      m_bytes_per_chunk(expand_to_bytes(k_default_chunk_size)) {
   disable_index_files();
   dont_rename_data_files();
   // calling this in the constructor sets the default value
@@ -50,6 +65,8 @@ const shcore::Option_pack_def<Export_table_options>
           .include<Dump_options>()
           .optional("where", &Export_table_options::m_where)
           .optional("partitions", &Export_table_options::m_partitions)
+          .optional("threads", &Export_table_options::m_threads)
+          .optional("bytesPerChunk", &Export_table_options::set_bytes_per_chunk)
           .include(&Export_table_options::m_oci_bucket_options)
           .include(&Export_table_options::m_s3_bucket_options)
           .include(&Export_table_options::m_blob_storage_options)
@@ -75,6 +92,27 @@ void Export_table_options::on_unpacked_options() {
   if (m_blob_storage_options) {
     set_storage_config(m_blob_storage_options.config());
   }
+
+  if (m_bytes_per_chunk < expand_to_bytes(k_minimum_chunk_size)) {
+    throw std::invalid_argument(
+        "The value of 'bytesPerChunk' option must be greater than or equal "
+        "to " +
+        std::string(k_minimum_chunk_size) + ".");
+  }
+
+  if (0 == m_threads) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
+  }
+}
+
+void Export_table_options::set_bytes_per_chunk(const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'bytesPerChunk' cannot be set to an empty string.");
+  }
+
+  m_bytes_per_chunk = expand_to_bytes(value);
 }
 
 void Export_table_options::set_table(const std::string &schema_table) {
@@ -63,17 +63,23 @@ class Export_table_options : public Dump_options {
 
   bool use_single_file() const override { return true; }
 
-  bool split() const override { return false; }
+  /**
+   * Table is chunked only when it is exported using multiple threads.
+   */
+  bool split() const override { return m_threads > 1; }
 
-  uint64_t bytes_per_chunk() const override { return 0; }
+  uint64_t bytes_per_chunk() const override { return m_bytes_per_chunk; }
 
-  std::size_t threads() const override { return 1; }
+  std::size_t threads() const override { return m_threads; }
 
   bool dump_ddl() const override { return false; }
 
   bool dump_data() const override { return true; }
 
-  bool consistent_dump() const override { return false; }
+  /**
+   * When exporting in parallel, all threads need to use the same snapshot.
+   */
+  bool consistent_dump() const override { return split(); }
 
   bool skip_consistency_checks() const override { return true; }
 
@@ -103,12 +109,17 @@ class Export_table_options : public Dump_options {
 
   void on_set_schema();
 
+  void set_bytes_per_chunk(const std::string &value);
+
   std::string m_schema;
   std::string m_table;
 
   std::string m_where;
   std::unordered_set<std::string> m_partitions;
 
+  uint64_t m_threads = 1;
+  uint64_t m_bytes_per_chunk;
+
   mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
   mysqlshdk::aws::S3_bucket_options m_s3_bucket_options;
   mysqlshdk::azure::Blob_storage_options m_blob_storage_options;
@@ -589,7 +589,15 @@ void Schema_dumper::switch_character_set_results(const char *cs_name) {
 }
 
 void Schema_dumper::use(const std::string &db) const {
+  // dumper has exclusive access to the session, if the same instance is used
+  // to dump multiple objects of a schema, it's enough to switch once
+  if (m_current_schema.has_value() && *m_current_schema == db) {
+    return;
+  }
+
+  m_current_schema.reset();
   m_mysql->executef("USE !", db);
+  m_current_schema = db;
 }
 
 void Schema_dumper::unescape(IFile *file, std::string_view s) {
@@ -996,22 +1004,29 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
     }
   }
 
+  // checks of the table options which are not present are skipped, filter is
+  // reused to avoid allocations
+  thread_local compatibility::Create_table_option_filter filter;
+  const auto check_options =
+      opt_mysqlaas || opt_force_innodb || opt_strip_tablespaces;
+
+  if (check_options) {
+    filter.reset(*create_table);
+  }
+
   if (opt_mysqlaas) {
-    if (compatibility::check_create_table_for_data_index_dir_option(
-            *create_table, create_table))
+    if (filter.data_index_dir_option(true))
       res.emplace_back(
           prefix + "had {DATA|INDEX} DIRECTORY table option commented out",
           Issue::Status::FIXED);
 
-    if (compatibility::check_create_table_for_encryption_option(*create_table,
-                                                                create_table))
+    if (filter.encryption_option(true))
       res.emplace_back(prefix + "had ENCRYPTION table option commented out",
                        Issue::Status::FIXED);
   }
 
   if (opt_mysqlaas || opt_force_innodb) {
-    const auto engine = compatibility::check_create_table_for_engine_option(
-        *create_table, opt_force_innodb ? create_table : nullptr);
+    const auto engine = filter.engine_option(opt_force_innodb);
     if (!engine.empty()) {
       if (opt_force_innodb)
         res.emplace_back(
@@ -1026,8 +1041,7 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
     // FIXED row format right away
     const auto remove_fixed_row_format = opt_force_innodb || engine.empty();
 
-    if (compatibility::check_create_table_for_fixed_row_format(
-            *create_table, remove_fixed_row_format ? create_table : nullptr)) {
+    if (filter.fixed_row_format(remove_fixed_row_format)) {
       if (remove_fixed_row_format) {
         res.emplace_back(
             prefix + "had unsupported ROW_FORMAT=FIXED option removed",
@@ -1040,8 +1054,7 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
   }
 
   if (opt_mysqlaas || opt_strip_tablespaces) {
-    if (compatibility::check_create_table_for_tablespace_option(
-            *create_table, opt_strip_tablespaces ? create_table : nullptr)) {
+    if (filter.tablespace_option(opt_strip_tablespaces)) {
       if (opt_strip_tablespaces)
         res.emplace_back(prefix + "had unsupported tablespace option removed",
                          Issue::Status::FIXED);
@@ -1051,6 +1064,10 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
     }
   }
 
+  if (check_options) {
+    *create_table = filter.statement();
+  }
+
   if (opt_mysqlaas) {
     std::size_t count = 0;
 
@@ -243,6 +243,9 @@ class Schema_dumper {
 
   mutable std::optional<bool> m_partial_revokes;
 
+  // schema selected by the last call to use()
+  mutable std::optional<std::string> m_current_schema;
+
   bool m_non_existing_definer_reported = false;
 
  private:
@@ -250,6 +250,35 @@ void Import_table_option_pack::set_columns(const shcore::Array_t &columns) {
   }
 }
 
+void Import_table_option_pack::exclude_columns(
+    const std::unordered_set<std::string> &columns) {
+  if (columns.empty()) {
+    return;
+  }
+
+  if (m_columns.empty()) {
+    throw std::runtime_error(
+        "The 'columns' option is required when columns are excluded.");
+  }
+
+  // use user variables which are not already bound
+  uint64_t variable = 0;
+
+  for (const auto &c : m_columns) {
+    if (const auto v = std::get_if<uint64_t>(&c)) {
+      variable = std::max(variable, *v + 1);
+    }
+  }
+
+  for (auto &c : m_columns) {
+    if (const auto name = std::get_if<std::string>(&c);
+        name && columns.count(*name)) {
+      m_decode_columns.erase(*name);
+      c = variable++;
+    }
+  }
+}
+
 bool Import_table_option_pack::check_if_multifile() {
   if (m_filelist_from_user.size() == 1) {
     if (storage_config() ||
@@ -280,7 +309,8 @@ bool Import_table_option_pack::is_compressed(const std::string &path) {
   const auto extension = std::get<1>(shcore::path::split_extension(path));
 
   return extension == get_extension(Compression::GZIP) ||
-         extension == get_extension(Compression::ZSTD);
+         extension == get_extension(Compression::ZSTD) ||
+         extension == get_extension(Compression::LZ4);
 }
 
 void Import_table_option_pack::set_replace_duplicates(bool flag) {
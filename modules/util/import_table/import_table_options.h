@@ -37,6 +37,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
@@ -110,6 +111,11 @@ class Import_table_option_pack {
 
   void clear_columns() { m_columns.clear(); }
 
+  /**
+   * Values of the given columns are read into user variables and discarded.
+   */
+  void exclude_columns(const std::unordered_set<std::string> &columns);
+
   const std::map<std::string, std::string> &decode_columns() const {
     return m_decode_columns;
   }
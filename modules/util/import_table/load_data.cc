@@ -621,6 +621,24 @@ int local_infile_error(void *userdata, char *error_msg,
   return CR_UNKNOWN_ERROR;
 }
 
+void set_local_infile_callbacks(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    File_info *file_info) {
+  session->set_local_infile_userdata(static_cast<void *>(file_info));
+
+  if (file_info) {
+    session->set_local_infile_init(local_infile_init);
+    session->set_local_infile_read(local_infile_read);
+    session->set_local_infile_end(local_infile_end);
+    session->set_local_infile_error(local_infile_error);
+  } else {
+    session->set_local_infile_init(local_infile_init_nop);
+    session->set_local_infile_read(local_infile_read_nop);
+    session->set_local_infile_end(local_infile_end_nop);
+    session->set_local_infile_error(local_infile_error_nop);
+  }
+}
+
 Load_data_worker::Load_data_worker(
     const Import_table_options &options, int64_t thread_id,
     std::atomic<size_t> *prog_data_bytes, std::atomic<size_t> *prog_file_bytes,
@@ -655,11 +673,7 @@ void Load_data_worker::operator()() {
   // Prevent local infile rogue server attack. Safe local infile callbacks
   // must be set before connecting to the MySQL Server. Otherwise, rogue MySQL
   // Server can ask for arbitrary file from client.
-  session->set_local_infile_userdata(nullptr);
-  session->set_local_infile_init(local_infile_init_nop);
-  session->set_local_infile_read(local_infile_read_nop);
-  session->set_local_infile_end(local_infile_end_nop);
-  session->set_local_infile_error(local_infile_error_nop);
+  set_local_infile_callbacks(session, nullptr);
 
   try {
     auto const conn_opts = m_opt.connection_options();
@@ -755,6 +769,9 @@ std::string Load_data_worker::load_data_body(
 
       case Compression::GZIP:
         throw std::logic_error("Unsupported LOAD DATA compression: gzip");
+
+      case Compression::LZ4:
+        throw std::logic_error("Unsupported LOAD DATA compression: lz4");
     }
 
     throw std::logic_error("Unhandled Compression value.");
@@ -850,11 +867,7 @@ void Load_data_worker::execute(
     };
 
     init_session(session, m_opt);
-    session->set_local_infile_userdata(static_cast<void *>(&fi));
-    session->set_local_infile_init(local_infile_init);
-    session->set_local_infile_read(local_infile_read);
-    session->set_local_infile_end(local_infile_end);
-    session->set_local_infile_error(local_infile_error);
+    set_local_infile_callbacks(session, &fi);
 
     const auto query_body = load_data_body(m_opt);
 
@@ -162,6 +162,15 @@ void local_infile_end(void *userdata) noexcept;
 int local_infile_error(void *userdata, char *error_msg,
                        unsigned int error_msg_len) noexcept;
 
+/**
+ * Sets the local infile callbacks of the given session, so that the data
+ * requested by the server is read using the given file info. If file info is
+ * null, callbacks which reject all requests are set instead.
+ */
+void set_local_infile_callbacks(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    File_info *file_info);
+
 class Load_data_worker final {
  public:
   Load_data_worker() = delete;
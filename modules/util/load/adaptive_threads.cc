@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/adaptive_threads.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlsh {
+
+Adaptive_threads::Adaptive_threads(uint64_t min_threads, uint64_t max_threads)
+    : m_min_threads(std::min(min_threads, max_threads)),
+      m_max_threads(max_threads),
+      m_threads(max_threads) {}
+
+bool Adaptive_threads::sample(uint64_t throughput,
+                              const std::string &pressure) {
+  bool changed = false;
+
+  if (!pressure.empty()) {
+    changed =
+        set_threads(m_threads - std::max<uint64_t>(1, m_threads / 4), pressure);
+    m_grown = false;
+    m_hold = k_hold_samples;
+  } else if (m_grown && static_cast<double>(throughput) <
+                            k_min_improvement * m_throughput) {
+    // additional thread did not help
+    changed = set_threads(m_threads - 1, "throughput did not improve");
+    m_grown = false;
+    m_hold = k_hold_samples;
+  } else if (m_hold) {
+    --m_hold;
+    m_grown = false;
+  } else if (m_threads < m_max_threads) {
+    changed = set_threads(m_threads + 1, "no pressure on the server");
+    m_grown = changed;
+  } else {
+    m_grown = false;
+  }
+
+  m_throughput = throughput;
+
+  return changed;
+}
+
+bool Adaptive_threads::set_threads(uint64_t threads,
+                                   const std::string &reason) {
+  threads = std::clamp(threads, m_min_threads, m_max_threads);
+
+  if (threads == m_threads) {
+    return false;
+  }
+
+  log_info("Changing number of threads loading the data from %" PRIu64
+           " to %" PRIu64 ": %s",
+           m_threads, threads, reason.c_str());
+
+  m_threads = threads;
+
+  return true;
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_ADAPTIVE_THREADS_H_
+#define MODULES_UTIL_LOAD_ADAPTIVE_THREADS_H_
+
+#include <cstdint>
+#include <string>
+
+namespace mysqlsh {
+
+/**
+ * Decides on the number of threads which are loading the data, based on the
+ * periodic samples of the data load throughput and the load of the
+ * destination server:
+ *  - if server is under pressure, number of threads is quickly reduced,
+ *  - otherwise, threads are added one at a time, as long as this does not
+ *    decrease the throughput.
+ */
+class Adaptive_threads final {
+ public:
+  Adaptive_threads(uint64_t min_threads, uint64_t max_threads);
+
+  Adaptive_threads(const Adaptive_threads &) = default;
+  Adaptive_threads(Adaptive_threads &&) = default;
+
+  Adaptive_threads &operator=(const Adaptive_threads &) = default;
+  Adaptive_threads &operator=(Adaptive_threads &&) = default;
+
+  ~Adaptive_threads() = default;
+
+  /**
+   * Current number of threads.
+   */
+  uint64_t threads() const noexcept { return m_threads; }
+
+  /**
+   * Processes a sample taken while the data was being loaded.
+   *
+   * @param throughput Number of bytes loaded since the previous sample.
+   * @param pressure If not empty, reason why the server is under pressure.
+   *
+   * @returns true if number of threads has changed
+   */
+  bool sample(uint64_t throughput, const std::string &pressure);
+
+  /**
+   * Processes a sample taken while the data was not being loaded, the
+   * throughput cannot be measured.
+   */
+  void idle() noexcept { m_grown = false; }
+
+  // number of samples to wait after number of threads was reduced
+  static constexpr uint32_t k_hold_samples = 6;
+
+  // throughput after a thread was added needs to be at least this fraction of
+  // the previous one
+  static constexpr double k_min_improvement = 0.95;
+
+ private:
+  bool set_threads(uint64_t threads, const std::string &reason);
+
+  uint64_t m_min_threads;
+  uint64_t m_max_threads;
+  uint64_t m_threads;
+
+  uint32_t m_hold = 0;
+  bool m_grown = false;
+  uint64_t m_throughput = 0;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_ADAPTIVE_THREADS_H_
@@ -25,6 +25,7 @@
 
 #include "modules/util/load/dump_loader.h"
 
+#include <errmsg.h>
 #include <mysqld_error.h>
 
 #include <algorithm>
@@ -36,10 +37,13 @@
 #include <iterator>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "modules/mod_utils.h"
@@ -47,6 +51,7 @@
 #include "modules/util/dump/capability.h"
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/import_table/load_data.h"
+#include "modules/util/load/adaptive_threads.h"
 #include "modules/util/load/load_errors.h"
 #include "modules/util/load/load_progress_log.h"
 #include "mysqlshdk/include/scripting/shexcept.h"
@@ -55,6 +60,7 @@
 #include "mysqlshdk/libs/db/utils_error.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/utils.h"
+#include "mysqlshdk/libs/rest/rest_service.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/fault_injection.h"
@@ -107,6 +113,16 @@ using Reconnect = Dump_loader::Reconnect;
 constexpr auto k_temp_table_comment =
     "mysqlsh-tmp-218ffeec-b67b-4886-9a8c-d7812a1f93eb";
 
+// estimated amount of index data which is sorted by a single server thread
+// when building the secondary indexes of a table
+constexpr uint64_t k_index_build_bytes_per_thread = 10 * 1024 * 1024;  // 10MiB
+
+// minimum value of innodb_ddl_buffer_size
+constexpr uint64_t k_min_ddl_buffer_size = 64 * 1024;  // 64KiB
+
+// column of the staging table, used to copy its rows in ranges
+constexpr auto k_staging_row_id = "__mysqlsh_row_id";
+
 namespace sql {
 
 inline std::shared_ptr<mysqlshdk::db::IResult> query(const Session_ptr &session,
@@ -379,6 +395,21 @@ std::string format_table(const Dump_reader::Table_chunk &chunk) {
   return format_table(chunk.schema, chunk.table, chunk.partition, chunk.index);
 }
 
+// size of the chunk used when scheduling, uncompressed if it's known, same as
+// Table_data_info::bytes_remaining() once the dump metadata is available
+size_t scheduled_size(const Dump_reader::Table_chunk &chunk) {
+  return chunk.data_size ? chunk.data_size : chunk.file_size;
+}
+
+std::string format_range(const Dump_reader::Table_chunk &chunk) {
+  if (chunk.range_begin.empty()) {
+    return {};
+  }
+
+  return ", range: [" + shcore::str_join(chunk.range_begin, ", ") + "] - [" +
+         shcore::str_join(chunk.range_end, ", ") + "]";
+}
+
 std::string worker_id(size_t id) {
   return shcore::str_format("[Worker%03zu]: ", id);
 }
@@ -521,6 +552,166 @@ double add_index_progress(const Session_ptr &session, uint64_t statements,
   return progress;
 }
 
+/**
+ * Presents a sequence of files as a single stream, chunks of a table are
+ * sorted, so they can be sent using a single LOAD DATA LOCAL INFILE statement.
+ * Each time the stream is opened, it starts from the first file.
+ */
+class File_sequence final : public mysqlshdk::storage::IFile {
+ public:
+  File_sequence() = delete;
+
+  explicit File_sequence(
+      const std::vector<std::unique_ptr<mysqlshdk::storage::IFile>> &files)
+      : m_files(files) {
+    assert(!m_files.empty());
+  }
+
+  File_sequence(const File_sequence &) = delete;
+  File_sequence(File_sequence &&) = delete;
+
+  File_sequence &operator=(const File_sequence &) = delete;
+  File_sequence &operator=(File_sequence &&) = delete;
+
+  ~File_sequence() override {
+    try {
+      close();
+    } catch (const std::exception &e) {
+      log_error("Failed to close the file sequence: %s", e.what());
+    }
+  }
+
+  void open(mysqlshdk::storage::Mode m) override {
+    if (mysqlshdk::storage::Mode::READ != m) {
+      throw std::logic_error("File_sequence::open() - read-only");
+    }
+
+    close();
+
+    m_current = 0;
+    m_offset = 0;
+    m_files[m_current]->open(m);
+    m_open = true;
+  }
+
+  bool is_open() const override { return m_open; }
+
+  int error() const override {
+    return m_current < m_files.size() ? m_files[m_current]->error() : 0;
+  }
+
+  void close() override {
+    if (m_current < m_files.size() && m_files[m_current]->is_open()) {
+      m_files[m_current]->close();
+    }
+
+    m_open = false;
+  }
+
+  size_t file_size() const override {
+    size_t size = 0;
+
+    for (const auto &file : m_files) {
+      size += file->file_size();
+    }
+
+    return size;
+  }
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_files.front()->full_path();
+  }
+
+  std::string filename() const override { return m_files.front()->filename(); }
+
+  bool exists() const override { return true; }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    return m_files.front()->parent();
+  }
+
+  off64_t seek(off64_t) override {
+    throw std::logic_error("File_sequence::seek() - not implemented");
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override {
+    while (m_current < m_files.size()) {
+      const auto bytes = m_files[m_current]->read(buffer, length);
+
+      if (bytes < 0) {
+        return bytes;
+      }
+
+      if (bytes > 0) {
+        m_offset += bytes;
+        return bytes;
+      }
+
+      // EOF, move to the next file
+      m_files[m_current]->close();
+
+      if (++m_current < m_files.size()) {
+        m_files[m_current]->open(mysqlshdk::storage::Mode::READ);
+      }
+    }
+
+    return 0;
+  }
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("File_sequence::write() - read-only");
+  }
+
+  bool flush() override { return true; }
+
+  bool is_local() const override { return m_files.front()->is_local(); }
+
+  void rename(const std::string &) override {
+    throw std::logic_error("File_sequence::rename() - not implemented");
+  }
+
+  void remove() override {
+    throw std::logic_error("File_sequence::remove() - not implemented");
+  }
+
+ private:
+  const std::vector<std::unique_ptr<mysqlshdk::storage::IFile>> &m_files;
+  std::size_t m_current = 0;
+  off64_t m_offset = 0;
+  bool m_open = false;
+};
+
+/**
+ * Executes LOAD DATA LOCAL INFILE statement, streaming contents of the given
+ * file.
+ */
+void execute_local_infile(const Session_ptr &session,
+                          const std::string &statement,
+                          const import_table::Dialect &dialect,
+                          std::unique_ptr<mysqlshdk::storage::IFile> file,
+                          shcore::atomic_flag *interrupt) {
+  // progress is reported by the caller
+  std::atomic<size_t> data_bytes{0};
+  std::atomic<size_t> file_bytes{0};
+  import_table::File_info fi;
+
+  fi.prog_data_bytes = &data_bytes;
+  fi.prog_file_bytes = &file_bytes;
+  fi.user_interrupt = interrupt;
+  fi.filehandler = std::move(file);
+  fi.buffer = import_table::Transaction_buffer(dialect, fi.filehandler.get());
+
+  import_table::set_local_infile_callbacks(session, &fi);
+  shcore::on_leave_scope reset_callbacks{[&session]() {
+    import_table::set_local_infile_callbacks(session, nullptr);
+  }};
+
+  // statement is not idempotent - do not reconnect
+  sql::execute(session, statement);
+}
+
 }  // namespace
 
 class Dump_loader::Monitoring final {
@@ -603,6 +794,114 @@ class Dump_loader::Monitoring final {
   std::unordered_set<const Worker *> m_workers;
 };
 
+/**
+ * Periodically samples the data load throughput and the load of the
+ * destination server, and limits the number of threads which are executing
+ * tasks accordingly. Server is under pressure if InnoDB is waiting for free
+ * pages in the buffer pool, or the checkpoint age is close to the redo log
+ * capacity.
+ */
+class Dump_loader::Thread_throttle final {
+ public:
+  explicit Thread_throttle(Dump_loader *loader)
+      : m_loader(loader),
+        m_threads(loader->m_options.min_threads_count(),
+                  loader->m_options.threads_count()) {}
+
+  Thread_throttle(const Thread_throttle &) = delete;
+  Thread_throttle(Thread_throttle &&) = delete;
+
+  Thread_throttle &operator=(const Thread_throttle &) = delete;
+  Thread_throttle &operator=(Thread_throttle &&) = delete;
+
+  ~Thread_throttle() = default;
+
+  void sample(const Session_ptr &session) {
+    // monitors are executed every 250ms, give the server some time to react to
+    // the previous change
+    if (++m_ticks < k_ticks_per_sample) {
+      return;
+    }
+
+    m_ticks = 0;
+
+    const auto bytes = m_loader->m_stats.total_data_bytes.load();
+    const auto throughput = bytes - m_bytes;
+    m_bytes = bytes;
+
+    std::string reason;
+
+    try {
+      reason = server_pressure(session);
+    } catch (const std::exception &e) {
+      log_warning("Failed to check the load of the server: %s", e.what());
+      return;
+    }
+
+    if (0 == m_loader->m_num_threads_loading) {
+      m_threads.idle();
+    } else if (m_threads.sample(throughput, reason)) {
+      m_loader->m_thread_limit = m_threads.threads();
+    }
+  }
+
+ private:
+  // 5 seconds
+  static constexpr uint32_t k_ticks_per_sample = 20;
+
+  // maximum checkpoint age, as a fraction of redo log capacity
+  static constexpr double k_max_checkpoint_age = 0.75;
+
+  std::string server_pressure(const Session_ptr &session) {
+    // no reconnection - we're using the monitoring session
+    const auto result = sql::query(
+        session,
+        "SELECT VARIABLE_NAME, CAST(VARIABLE_VALUE AS UNSIGNED) FROM "
+        "performance_schema.global_status WHERE VARIABLE_NAME IN "
+        "('Innodb_buffer_pool_wait_free','Innodb_redo_log_current_lsn',"
+        "'Innodb_redo_log_checkpoint_lsn','Innodb_redo_log_capacity_resized')");
+    std::unordered_map<std::string, uint64_t> status;
+
+    while (const auto row = result->fetch_one()) {
+      status.emplace(row->get_string(0), row->get_uint(1));
+    }
+
+    const auto get = [&status](const char *name) -> uint64_t {
+      const auto it = status.find(name);
+      return status.end() == it ? 0 : it->second;
+    };
+
+    std::string reason;
+    const auto wait_free = get("Innodb_buffer_pool_wait_free");
+
+    if (m_wait_free.has_value() && wait_free > *m_wait_free) {
+      reason = "InnoDB is waiting for free pages in the buffer pool";
+    }
+
+    m_wait_free = wait_free;
+
+    // redo log status variables are available in 8.0.30+
+    if (const auto capacity = get("Innodb_redo_log_capacity_resized")) {
+      const auto current = get("Innodb_redo_log_current_lsn");
+      const auto checkpoint = get("Innodb_redo_log_checkpoint_lsn");
+
+      if (current > checkpoint && static_cast<double>(current - checkpoint) >
+                                      k_max_checkpoint_age * capacity) {
+        reason = "checkpoint age is close to the redo log capacity";
+      }
+    }
+
+    return reason;
+  }
+
+  Dump_loader *m_loader;
+  Adaptive_threads m_threads;
+
+  uint32_t m_ticks = 0;
+  std::size_t m_bytes = 0;
+  std::optional<uint64_t> m_wait_free;
+};
+
 class Dump_loader::Bulk_load_support {
  public:
   explicit Bulk_load_support(Dump_loader *loader)
@@ -659,8 +958,8 @@ class Dump_loader::Bulk_load_support {
     m_loader->m_stats.total_file_bytes += file_bytes_update;
   }
 
-  static import_table::Import_table_options import_options(
-      const Dump_reader::Table_chunk &chunk, const std::string &table) {
+  import_table::Import_table_options import_options(
+      const Dump_reader::Table_chunk &chunk, const std::string &table) const {
     // NOTE: partition is not a part of chunk.options, so it doesn't need to be
     //       removed even if table is partitioned
     auto import_options =
@@ -671,7 +970,10 @@ class Dump_loader::Bulk_load_support {
         import_table::Duplicate_handling::Default);
     import_options.set_verbose(false);
     import_options.set_table(table);
-    import_options.set_compression(chunk.compression);
+    // LOCAL input is decompressed by the client
+    import_options.set_compression(local_input()
+                                       ? mysqlshdk::storage::Compression::NONE
+                                       : chunk.compression);
 
     // BULK LOAD does not support column list specification or input
     // preprocessing. Dumper always provides a list of columns, which is a
@@ -693,9 +995,21 @@ class Dump_loader::Bulk_load_support {
     return load_statement(chunk, import_options(chunk, table), dry_run);
   }
 
+  bool local_input() const noexcept {
+    return Load_dump_options::Bulk_load_fs::LOCAL == m_bulk_load_info.fs;
+  }
+
   std::string load_statement(const Dump_reader::Table_chunk &chunk,
                              const import_table::Import_table_options &options,
                              bool dry_run) const {
+    if (local_input()) {
+      // all chunks are sent as a single stream, dry run is not supported
+      return shcore::sqlformat("LOAD DATA LOCAL INFILE ? IN PRIMARY KEY ORDER ",
+                               chunk.file->full_path().masked()) +
+             import_table::Load_data_worker::load_data_body(options) +
+             " ALGORITHM=BULK";
+    }
+
     std::string result = "LOAD DATA FROM ";
 
     switch (m_bulk_load_info.fs) {
@@ -713,6 +1027,9 @@ class Dump_loader::Bulk_load_support {
       case Load_dump_options::Bulk_load_fs::S3:
         result += "S3";
         break;
+
+      case Load_dump_options::Bulk_load_fs::LOCAL:
+        throw std::logic_error("BULK LOAD: LOCAL input is handled above");
     }
 
     {
@@ -773,6 +1090,14 @@ class Dump_loader::Bulk_load_support {
       }
     }
 
+    if (local_input()) {
+      // LOCAL input does not support a dry run, the table is checked when it's
+      // loaded, if server rejects the statement, load falls back to chunks
+      m_compatibility_status[chunk.schema][chunk.table] = true;
+      ++m_compatible_tables;
+      return true;
+    }
+
     auto table_name = chunk.table;
     shcore::on_leave_scope cleanup;
 
@@ -800,6 +1125,19 @@ class Dump_loader::Bulk_load_support {
     return compatible;
   }
 
+  /**
+   * Marks the table as not compatible, used when LOCAL input was rejected by
+   * the server.
+   */
+  void set_table_incompatible(const Dump_reader::Table_chunk &chunk) {
+    auto &status = m_compatibility_status[chunk.schema][chunk.table];
+
+    if (status) {
+      status = false;
+      --m_compatible_tables;
+    }
+  }
+
   std::function<void()> copy_table_remove_partition(
       const Dump_reader::Table_chunk &chunk, const Reconnect &reconnect,
       const Session_ptr &session, std::string *new_table) const {
@@ -1301,7 +1639,7 @@ void Dump_loader::Worker::Load_data_task::load(Dump_loader *loader,
     std::lock_guard<std::mutex> lock(loader->m_tables_being_loaded_mutex);
     auto it = loader->m_tables_being_loaded.find(key());
     while (it != loader->m_tables_being_loaded.end() && it->first == key()) {
-      if (it->second == chunk().file_size) {
+      if (it->second == scheduled_size(chunk())) {
         loader->m_tables_being_loaded.erase(it);
         break;
       }
@@ -1385,6 +1723,65 @@ void Dump_loader::Worker::Load_chunk_task::do_load(Worker *worker,
     }
   }
 
+  const auto &session = worker->session();
+  std::string staging_table;
+  shcore::on_leave_scope drop_staging_table;
+  uint64_t copy_trx_size = 0;
+
+  if (loader->m_dump->where(schema(), table()).empty()) {
+    import_options.exclude_columns(
+        loader->m_dump->excluded_columns(schema(), table()));
+  } else {
+    // LOAD DATA cannot filter rows, chunk is loaded into a temporary table
+    // first, rows matching the condition are then copied to the target table,
+    // condition may refer to the excluded columns; temporary tables are not
+    // written to the binary log, so the size of the chunk does not affect the
+    // replication; rows are numbered, so that they can be copied in ranges
+    staging_table = loader->temp_table_name();
+
+    // columns are listed explicitly, SELECT * would skip the INVISIBLE ones
+    // (i.e. generated invisible primary key), which are written by the dumper
+    std::vector<std::string> columns;
+
+    for (const auto &c : import_options.columns()) {
+      if (const auto name = std::get_if<std::string>(&c)) {
+        columns.emplace_back(shcore::quote_identifier(*name));
+      }
+    }
+
+    if (columns.empty()) {
+      throw std::runtime_error(
+          "The 'columns' option is required when rows are filtered.");
+    }
+
+    // statement is not idempotent - do not reconnect
+    sql::execute(session,
+                 shcore::sqlformat("CREATE TEMPORARY TABLE !.! (! BIGINT "
+                                   "UNSIGNED NOT NULL AUTO_INCREMENT PRIMARY "
+                                   "KEY) SELECT ",
+                                   schema(), staging_table, k_staging_row_id) +
+                     shcore::str_join(columns, ", ") + " FROM " + key() +
+                     " LIMIT 0");
+
+    drop_staging_table = shcore::on_leave_scope{[&]() {
+      try {
+        sql::executef(session, "DROP TEMPORARY TABLE IF EXISTS !.!", schema(),
+                      staging_table);
+      } catch (const std::exception &e) {
+        log_warning("%sFailed to drop the temporary table `%s`.`%s`: %s",
+                    log_id(), schema().c_str(), staging_table.c_str(),
+                    e.what());
+      }
+    }};
+
+    import_options.set_table(staging_table);
+    import_options.set_partition({});
+
+    // rows are not loaded directly into the target table, whole chunk needs
+    // to be processed again
+    m_bytes_to_skip = 0;
+  }
+
   import_table::Load_data_worker op(
       import_options, id(), &loader->m_stats.total_data_bytes,
       &loader->m_stats.total_file_bytes, &loader->m_worker_hard_interrupt,
@@ -1435,6 +1832,14 @@ void Dump_loader::Worker::Load_chunk_task::do_load(Worker *worker,
       }
     }
 
+    if (!staging_table.empty()) {
+      // temporary table is not replicated, there's no need to sub-chunk, rows
+      // are copied to the target table in transactions of this size instead
+      copy_trx_size = options.max_trx_size;
+      options.max_trx_size = 0;
+      options.fast_sub_chunking = false;
+    }
+
     uint64_t subchunk = 0;
 
     options.transaction_started = [this, &loader, &worker, &subchunk]() {
@@ -1496,10 +1901,126 @@ void Dump_loader::Worker::Load_chunk_task::do_load(Worker *worker,
     stats.total_data_bytes += m_bytes_to_skip;
     loader->m_stats.total_data_bytes += m_bytes_to_skip;
 
-    op.execute(worker->session(), extract_file(), options);
+    // decompress the next block of data while server is processing the
+    // current one
+    op.execute(worker->session(),
+               mysqlshdk::storage::read_ahead(extract_file()), options);
+  }
+
+  if (loader->m_thread_exceptions[id()]) {
+    return;
+  }
+
+  if (!staging_table.empty()) {
+    copy_matching_rows(worker, loader, import_options, staging_table,
+                       copy_trx_size);
+  } else if (0 == m_bytes_to_skip && chunk().rows.has_value() &&
+             *chunk().rows != stats.total_records) {
+    // whole chunk was processed, number of rows should match the metadata
+    log_warning("%sChunk %zi of %s was expected to have %" PRIu64
+                " rows, but %zu rows were processed",
+                log_id(), chunk().index, key().c_str(), *chunk().rows,
+                stats.total_records.load());
   }
 }
 
+void Dump_loader::Worker::Load_chunk_task::copy_matching_rows(
+    Worker *worker, Dump_loader *loader,
+    const import_table::Import_table_options &options,
+    const std::string &staging_table, uint64_t max_trx_size) {
+  const auto &excluded = loader->m_dump->excluded_columns(schema(), table());
+  std::vector<std::string> columns;
+
+  for (const auto &c : options.columns()) {
+    if (const auto name = std::get_if<std::string>(&c);
+        name && !excluded.count(*name)) {
+      columns.emplace_back(shcore::quote_identifier(*name));
+    }
+  }
+
+  const auto column_list = shcore::str_join(columns, ", ");
+  std::string query;
+
+  switch (options.duplicate_handling()) {
+    case import_table::Duplicate_handling::Default:
+      query = "INSERT INTO ";
+      break;
+
+    case import_table::Duplicate_handling::Replace:
+      query = "REPLACE INTO ";
+      break;
+
+    case import_table::Duplicate_handling::Ignore:
+      query = "INSERT IGNORE INTO ";
+      break;
+  }
+
+  query += key();
+
+  if (!chunk().partition.empty()) {
+    query += " PARTITION (" + shcore::quote_identifier(chunk().partition) + ')';
+  }
+
+  const auto row_id = shcore::quote_identifier(k_staging_row_id);
+
+  query += " (" + column_list + ") SELECT " + column_list + " FROM " +
+           schema_object_key(schema(), staging_table) + " WHERE " +
+           loader->m_dump->where(schema(), table()) + " AND " + row_id +
+           " BETWEEN ";
+
+  const auto &session = worker->session();
+  // no reconnection - temporary table exists only in this session
+  const auto last_row = sql::queryf(session,
+                                    "SELECT CAST(IFNULL(MAX(!), 0) AS "
+                                    "UNSIGNED) FROM !.!",
+                                    k_staging_row_id, schema(), staging_table)
+                            ->fetch_one_or_throw()
+                            ->get_uint(0);
+
+  // copy the rows in transactions of roughly the same size as the sub-chunks
+  // would be, if the chunk was loaded directly into the target table
+  uint64_t rows_per_trx = last_row;
+
+  if (max_trx_size > 0 && chunk().data_size > max_trx_size) {
+    rows_per_trx = std::max<uint64_t>(
+        1, last_row * max_trx_size / chunk().data_size);
+  }
+
+  size_t records = 0;
+  size_t duplicates = 0;
+  size_t warnings = 0;
+
+  for (uint64_t first = 1; first <= last_row; first += rows_per_trx) {
+    const auto last = std::min(last_row, first + rows_per_trx - 1);
+
+    // statement is not idempotent - do not reconnect
+    sql::execute(session, query_comment() + query + std::to_string(first) +
+                              " AND " + std::to_string(last));
+
+    if (const auto info = session->get_mysql_info()) {
+      size_t r = 0;
+      size_t d = 0;
+      size_t w = 0;
+
+      sscanf(info, "Records: %zu  Duplicates: %zu  Warnings: %zu\n", &r, &d,
+             &w);
+
+      records += r;
+      duplicates += d;
+      warnings += w;
+    }
+  }
+
+  log_debug("%sCopied %zu out of %zu rows of the chunk %zi into %s", log_id(),
+            records, stats.total_records.load(), chunk().index, key().c_str());
+
+  // rows which do not match the condition are reported as skipped
+  stats.total_skipped += stats.total_records - records;
+  stats.total_records = records;
+  stats.total_deleted += duplicates;
+  stats.total_warnings += warnings;
+}
+
 void Dump_loader::Worker::Load_chunk_task::on_load_end(Worker *worker,
                                                        Dump_loader *loader) {
   FI_TRIGGER_TRAP(dump_loader, mysqlshdk::utils::FI::Trigger_options(
@@ -1559,7 +2080,7 @@ void Dump_loader::Worker::Bulk_load_task::do_load(Worker *worker,
 
     bulk_load(worker, loader);
 
-    if (partitioned()) {
+    if (partitioned() && !m_incompatible) {
       // statement is not idempotent - do not reconnect
       sql::executef(worker->session(),
                     "ALTER TABLE !.! EXCHANGE PARTITION ! WITH TABLE !.! "
@@ -1589,7 +2110,7 @@ bool Dump_loader::Worker::Bulk_load_task::partitioned() const {
 void Dump_loader::Worker::Bulk_load_task::bulk_load(Worker *worker,
                                                     Dump_loader *loader) {
   const auto import_options =
-      Bulk_load_support::import_options(chunk(), m_target_table);
+      loader->m_bulk_load->import_options(chunk(), m_target_table);
   const auto &session = worker->session();
 
   import_table::Load_data_worker::init_session(session, import_options);
@@ -1603,8 +2124,16 @@ void Dump_loader::Worker::Bulk_load_task::bulk_load(Worker *worker,
   while (true) {
     try {
       log_debug("%sExecuting bulk load", log_id());
-      // this statement has a precondition above, no reconnection
-      sql::execute(session, statement);
+
+      if (m_files.empty()) {
+        // this statement has a precondition above, no reconnection
+        sql::execute(session, statement);
+      } else {
+        execute_local_infile(session, statement, import_options.dialect(),
+                             std::make_unique<File_sequence>(m_files),
+                             &loader->m_worker_interrupt);
+      }
+
       break;
     } catch (const mysqlshdk::db::Error &e) {
       log_debug("%sBulk load error: %s", log_id(), e.format().c_str());
@@ -1612,6 +2141,14 @@ void Dump_loader::Worker::Bulk_load_task::bulk_load(Worker *worker,
 
       if (loader->m_bulk_load->wait_for_retry(e)) {
         log_info("%sRetrying bulk load", log_id());
+      } else if (!m_files.empty() && e.code() < CR_MIN_ERROR &&
+                 !loader->m_worker_interrupt.test()) {
+        // compatibility of this table was not tested, BULK LOAD is atomic, so
+        // table is still empty and its chunks can be loaded normally
+        log_info("Table %s is not compatible with BULK LOAD: %s",
+                 key().c_str(), e.format().c_str());
+        m_incompatible = true;
+        return;
       } else {
         log_info("%sNot retrying bulk load", log_id());
         throw;
@@ -1693,6 +2230,46 @@ bool Dump_loader::Worker::Analyze_table_task::execute(Worker *worker,
   return true;
 }
 
+bool Dump_loader::set_add_index_budget(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    const Load_dump_options::Add_index_limits &limits, uint64_t threads) {
+  if (0 == limits.ddl_threads) {
+    return false;
+  }
+
+  const auto ddl_threads = std::min(threads, limits.ddl_threads);
+  const auto buffer_size = std::max(
+      limits.ddl_buffer_size / limits.ddl_threads * ddl_threads,
+      k_min_ddl_buffer_size);
+
+  try {
+    sql::executef(session,
+                  "SET SESSION innodb_parallel_read_threads = ?, "
+                  "innodb_ddl_threads = ?, innodb_ddl_buffer_size = ?",
+                  std::min(threads, limits.parallel_read_threads), ddl_threads,
+                  buffer_size);
+  } catch (const mysqlshdk::db::Error &e) {
+    log_warning("Failed to set the resource limits for building indexes: %s",
+                e.format().c_str());
+    return false;
+  }
+
+  return true;
+}
+
+void Dump_loader::reset_add_index_budget(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session) noexcept {
+  try {
+    sql::execute(session,
+                 "SET SESSION innodb_parallel_read_threads = DEFAULT, "
+                 "innodb_ddl_threads = DEFAULT, "
+                 "innodb_ddl_buffer_size = DEFAULT");
+  } catch (const std::exception &e) {
+    log_warning("Failed to reset the resource limits for building indexes: %s",
+                e.what());
+  }
+}
+
 bool Dump_loader::Worker::Index_recreation_task::execute(Worker *worker,
                                                          Dump_loader *loader) {
   log_debug("%swill build %zu indexes for table %s", log_id(),
@@ -1756,6 +2333,15 @@ bool Dump_loader::Worker::Index_recreation_task::execute(Worker *worker,
     const auto &session = worker->session();
     auto current = batches.begin();
     const auto end = batches.end();
+    shcore::on_leave_scope reset_budget;
+
+    if (!loader->m_options.dry_run() &&
+        set_add_index_budget(session, loader->m_options.add_index_limits(),
+                             weight())) {
+      // restore session variables, also if building of indexes fails
+      reset_budget = shcore::on_leave_scope{
+          [&session]() { reset_add_index_budget(session); }};
+    }
 
     while (end != current) {
       auto query = "ALTER TABLE " + key() + " ";
@@ -2456,8 +3042,12 @@ bool Dump_loader::schedule_table_chunk(Dump_reader::Table_chunk chunk) {
     return false;
   }
 
-  log_debug("Scheduling chunk for table %s (%s)", format_table(chunk).c_str(),
-            chunk.file->full_path().masked().c_str());
+  log_debug("Scheduling chunk for table %s (%s), data size: %zu, rows: %s%s",
+            format_table(chunk).c_str(),
+            chunk.file->full_path().masked().c_str(), chunk.data_size,
+            chunk.rows.has_value() ? std::to_string(*chunk.rows).c_str()
+                                   : "unknown",
+            format_range(chunk).c_str());
 
   mark_table_as_in_progress(chunk);
   push_pending_task(load_chunk_file(std::move(chunk), resuming, bytes_to_skip));
@@ -2516,7 +3106,6 @@ size_t Dump_loader::handle_worker_events(
   };
 
   std::list<Worker *> idle_workers;
-  const auto thread_count = m_options.threads_count();
 
   while (idle_workers.size() < m_workers.size()) {
     Worker_event event;
@@ -2684,8 +3273,12 @@ size_t Dump_loader::handle_worker_events(
         assert(!m_pending_tasks.empty());
 
         const auto pending_weight = m_pending_tasks.top()->weight();
+        // limit can be lowered below the weight of the heaviest task, such
+        // task is executed once all other tasks are done
+        const uint64_t thread_count = m_thread_limit;
 
-        if (m_current_weight + pending_weight > thread_count) {
+        if (m_current_weight &&
+            m_current_weight + pending_weight > thread_count) {
           // the task is too heavy, wait till more threads are idle
           idle_workers.push_back(event.worker);
         } else {
@@ -2693,7 +3286,9 @@ size_t Dump_loader::handle_worker_events(
           m_current_weight += pending_weight;
 
           // free any idle threads which were waiting for a heavy task
-          const auto available = thread_count - m_current_weight;
+          const auto available = thread_count > m_current_weight
+                                     ? thread_count - m_current_weight
+                                     : 0;
 
           for (uint64_t i = 0; i < available; ++i) {
             if (idle_workers.empty()) {
@@ -2822,6 +3417,8 @@ void Dump_loader::interruption_notification() {
 }
 
 void Dump_loader::run() {
+  m_transport_stats = mysqlshdk::rest::transport_stats();
+
   try {
     m_progress_thread.start();
     shcore::on_leave_scope cleanup_progress(
@@ -2865,6 +3462,11 @@ void Dump_loader::show_summary() {
 
   const auto console = current_console();
 
+  if (const auto stats = mysqlshdk::rest::transport_stats() - m_transport_stats;
+      stats.requests) {
+    log_info("REST transport: %s", stats.to_string().c_str());
+  }
+
   if (m_stats.total_records == m_rows_previously_loaded) {
     if (m_resuming)
       console->print_info("There was no remaining data left to be loaded.");
@@ -2933,6 +3535,8 @@ void Dump_loader::show_summary() {
 
     console->print_info(shcore::str_format(
         "Data load duration: %s", format_seconds(load_seconds, false).c_str()));
+
+    log_data_load_curve(load_seconds);
   }
 
   if (m_indexes_completed) {
@@ -3005,6 +3609,43 @@ void Dump_loader::show_summary() {
   }
 }
 
+void Dump_loader::log_data_load_curve(double load_seconds) const {
+  using mysqlshdk::utils::format_bytes;
+  using mysqlshdk::utils::format_seconds;
+
+  const auto total_bytes =
+      m_stats.total_data_bytes - m_data_bytes_previously_loaded;
+
+  if (m_table_data_completions.empty() || !total_bytes || load_seconds <= 0) {
+    return;
+  }
+
+  // tables are expected to finish at a constant rate, so that the last one is
+  // done when the whole data is loaded; a table which finishes much later than
+  // predicted has delayed the whole load
+  constexpr std::size_t k_max_points = 10;
+  const auto count = m_table_data_completions.size();
+  const auto step = std::max<std::size_t>(1, count / k_max_points);
+
+  log_info("Data load completion curve (predicted / actual time):");
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if ((i + 1) % step && i + 1 != count) {
+      continue;
+    }
+
+    const auto &completion = m_table_data_completions[i];
+    const auto data_bytes =
+        completion.data_bytes - m_data_bytes_previously_loaded;
+
+    log_info("  %zu/%zu tables done, %s loaded: %s / %s", i + 1, count,
+             format_bytes(data_bytes).c_str(),
+             format_seconds(load_seconds * data_bytes / total_bytes, false)
+                 .c_str(),
+             format_seconds(completion.seconds, false).c_str());
+  }
+}
+
 void Dump_loader::open_dump() { open_dump(m_options.create_dump_handle()); }
 
 void Dump_loader::open_dump(
@@ -4206,7 +4847,15 @@ void Dump_loader::spawn_workers() {
     }));
   }
 
+  m_thread_limit = m_options.threads_count();
   m_monitoring = std::make_unique<Monitoring>(this);
+
+  if (m_options.adaptive_threads()) {
+    m_thread_throttle = std::make_unique<Thread_throttle>(this);
+    m_monitoring->add([this](const Session_ptr &session) {
+      m_thread_throttle->sample(session);
+    });
+  }
 }
 
 void Dump_loader::join_workers() {
@@ -4296,7 +4945,7 @@ void Dump_loader::on_chunk_load_end(std::size_t,
 
   if (m_dump->on_chunk_loaded(chunk)) {
     // all data for this table/partition was loaded
-    ++m_unique_tables_loaded;
+    on_table_data_loaded();
   }
 
   ++m_data_load_tasks_completed;
@@ -4346,6 +4995,16 @@ void Dump_loader::on_bulk_load_progress(const shcore::Dictionary_t &event) {
 void Dump_loader::on_bulk_load_end(std::size_t,
                                    const Worker::Bulk_load_task *task) {
   const auto &chunk = task->chunk();
+
+  if (task->incompatible()) {
+    m_bulk_load->set_table_incompatible(chunk);
+    // chunks of this table are going to be scheduled again
+    m_dump->reschedule_table(chunk);
+    m_all_data_load_tasks_scheduled = false;
+    ++m_data_load_tasks_completed;
+    return;
+  }
+
   const auto &stats = task->stats;
   const size_t data_bytes_loaded = stats.total_data_bytes;
   const size_t file_bytes_loaded = stats.total_file_bytes;
@@ -4355,7 +5014,7 @@ void Dump_loader::on_bulk_load_end(std::size_t,
       file_bytes_loaded, stats.total_records});
 
   m_dump->on_table_loaded(chunk);
-  ++m_unique_tables_loaded;
+  on_table_data_loaded();
   ++m_data_load_tasks_completed;
 
   log_debug("Ended bulk loading table %s (%s, %s)", format_table(chunk).c_str(),
@@ -4363,6 +5022,15 @@ void Dump_loader::on_bulk_load_end(std::size_t,
             std::to_string(file_bytes_loaded).c_str());
 }
 
+void Dump_loader::on_table_data_loaded() {
+  ++m_unique_tables_loaded;
+
+  if (m_load_data_stage) {
+    m_table_data_completions.emplace_back(Table_data_completion{
+        m_load_data_stage->duration().current(), m_stats.total_data_bytes});
+  }
+}
+
 void Dump_loader::on_index_start(std::size_t worker_id,
                                  const Worker::Index_recreation_task *task) {
   assert(m_create_indexes_stage);
@@ -4898,8 +5566,21 @@ Dump_loader::Task_ptr Dump_loader::bulk_load_table(
   assert(!chunk.table.empty());
   assert(chunk.file);
 
+  std::vector<std::unique_ptr<mysqlshdk::storage::IFile>> files;
+
+  if (m_bulk_load->local_input()) {
+    files = m_dump->partition_files(chunk.schema, chunk.table, chunk.partition);
+
+    // the whole table is streamed by a single worker, decompress the next
+    // block of data while server is processing the current one
+    for (auto &file : files) {
+      file = mysqlshdk::storage::read_ahead(std::move(file));
+    }
+  }
+
   return std::make_unique<Worker::Bulk_load_task>(
-      std::move(chunk), resuming, m_options.bulk_load_info().threads);
+      std::move(chunk), resuming, m_options.bulk_load_info().threads,
+      std::move(files));
 }
 
 Dump_loader::Task_ptr Dump_loader::recreate_indexes(
@@ -4912,14 +5593,15 @@ Dump_loader::Task_ptr Dump_loader::recreate_indexes(
   uint64_t weight = m_options.threads_per_add_index();
 
   if (weight > 1) {
-    if (auto table_size = m_dump->table_data_size(schema, table)) {
-      // size per each thread
-      table_size /= weight;
-
-      // in case of small tables, we assume that they're not that impactful
-      if (table_size <= 10 * 1024 * 1024) {  // 10MiB
-        weight = 1;
-      }
+    if (const uint64_t table_size = m_dump->table_data_size(schema, table)) {
+      // each index is built from a full scan of the table, estimate the cost
+      // as amount of data which needs to be sorted, and assign the threads
+      // accordingly, small tables get one thread and can be built concurrently
+      const auto cost = table_size * std::max<uint64_t>(1, indexes->size());
+      weight = std::clamp<uint64_t>(
+          (cost + k_index_build_bytes_per_thread - 1) /
+              k_index_build_bytes_per_thread,
+          1, weight);
     }  // else, we don't have the size info, just use the default weight
   }
 
@@ -5109,6 +5791,13 @@ bool Dump_loader::bulk_load_supported(
     return false;
   }
 
+  // BULK LOAD cannot filter rows nor columns
+  if (!m_dump->where(chunk.schema, chunk.table).empty() ||
+      !m_dump->excluded_columns(chunk.schema, chunk.table).empty()) {
+    no_bulk_load("rows or columns of this table are filtered");
+    return false;
+  }
+
   // This is the first chunk, if it's in the progress log, then load is being
   // resumed and either: table didn't meet requirements to use the bulk load,
   // previous load was done by an older version which didn't support bulk load,
@@ -5121,9 +5810,16 @@ bool Dump_loader::bulk_load_supported(
     return false;
   }
 
-  // data should not be compressed or use zstd compression
-  if (mysqlshdk::storage::Compression::NONE != chunk.compression &&
-      mysqlshdk::storage::Compression::ZSTD != chunk.compression) {
+  if (m_bulk_load->local_input()) {
+    // data is streamed by the client, chunks need to be sorted, which is the
+    // case if table was chunked using the primary key
+    if (!m_dump->has_primary_key(chunk.schema, chunk.table)) {
+      no_bulk_load("LOCAL input requires a primary key");
+      return false;
+    }
+  } else if (mysqlshdk::storage::Compression::NONE != chunk.compression &&
+             mysqlshdk::storage::Compression::ZSTD != chunk.compression) {
+    // data should not be compressed or use zstd compression
     no_bulk_load("unsupported compression: " + to_string(chunk.compression));
     return false;
   }
@@ -5196,7 +5892,7 @@ void Dump_loader::mark_table_as_in_progress(
   std::lock_guard<std::mutex> lock(m_tables_being_loaded_mutex);
   m_tables_being_loaded.emplace(
       schema_table_object_key(chunk.schema, chunk.table, chunk.partition),
-      chunk.file_size);
+      scheduled_size(chunk));
 }
 
 void Dump_loader::setup_temp_tables() {
@@ -51,8 +51,10 @@
 #include "modules/util/load/load_progress_log.h"
 
 #include "modules/util/import_table/import_stats.h"
+#include "modules/util/import_table/import_table_options.h"
 
 #include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/rest/rest_service.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
 #include "mysqlshdk/libs/utils/atomic_flag.h"
@@ -255,18 +257,36 @@ class Dump_loader {
 
       void on_load_end(Worker *, Dump_loader *) override;
 
+      /**
+       * Copies rows which match the condition from the staging table to the
+       * target table, in transactions of up to max_trx_size bytes (0 - no
+       * limit).
+       */
+      void copy_matching_rows(Worker *worker, Dump_loader *loader,
+                              const import_table::Import_table_options &options,
+                              const std::string &staging_table,
+                              uint64_t max_trx_size);
+
       uint64_t m_bytes_to_skip = 0;
     };
 
     class Bulk_load_task : public Load_data_task {
      public:
-      Bulk_load_task(Dump_reader::Table_chunk chunk, bool resume,
-                     uint64_t weight)
+      Bulk_load_task(
+          Dump_reader::Table_chunk chunk, bool resume, uint64_t weight,
+          std::vector<std::unique_ptr<mysqlshdk::storage::IFile>> files = {})
           : Load_data_task(std::move(chunk), resume),
-            m_target_table(this->chunk().table) {
+            m_target_table(this->chunk().table),
+            m_files(std::move(files)) {
         set_weight(weight);
       }
 
+      /**
+       * Whether server rejected the LOAD DATA LOCAL INFILE statement, table
+       * was not loaded.
+       */
+      bool incompatible() const noexcept { return m_incompatible; }
+
      private:
       void on_load_start(Worker *, Dump_loader *) override;
 
@@ -279,6 +299,9 @@ class Dump_loader {
       void bulk_load(Worker *, Dump_loader *);
 
       std::string m_target_table;
+      // chunk files, used when data is streamed using LOCAL input
+      std::vector<std::unique_ptr<mysqlshdk::storage::IFile>> m_files;
+      bool m_incompatible = false;
     };
 
     class Analyze_table_task : public Task {
@@ -435,6 +458,8 @@ class Dump_loader {
 
   void show_summary();
 
+  void log_data_load_curve(double load_seconds) const;
+
   void on_dump_begin();
   void on_dump_end();
 
@@ -505,6 +530,8 @@ class Dump_loader {
   void on_bulk_load_end(std::size_t worker_id,
                         const Worker::Bulk_load_task *task);
 
+  void on_table_data_loaded();
+
   void on_checksum_start(
       const dump::common::Checksums::Checksum_data *checksum);
   void on_checksum_end(const dump::common::Checksums::Checksum_data *checksum,
@@ -585,6 +612,7 @@ class Dump_loader {
 #ifdef FRIEND_TEST
   FRIEND_TEST(Load_dump, sql_transforms_strip_sql_mode);
   FRIEND_TEST(Load_dump, add_execute_conditionally);
+  FRIEND_TEST(Load_dump, add_index_budget);
   friend class Load_dump_mocked;
   FRIEND_TEST(Load_dump_mocked, filter_user_script_for_mds);
 #endif
@@ -673,10 +701,32 @@ class Dump_loader {
     std::vector<Container> m_tasks;
   };
 
+  /**
+   * Limits the server resources used by the ALTER TABLE ... ADD INDEX
+   * statements executed in the given session to the given number of threads,
+   * so that concurrent index builds do not oversubscribe the server. Each
+   * thread keeps the share of innodb_ddl_buffer_size it would get with the
+   * global settings.
+   *
+   * @returns true if session variables were set
+   */
+  static bool set_add_index_budget(
+      const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+      const Load_dump_options::Add_index_limits &limits, uint64_t threads);
+
+  /**
+   * Restores the session variables changed by set_add_index_budget(), errors
+   * are logged.
+   */
+  static void reset_add_index_budget(
+      const std::shared_ptr<mysqlshdk::db::mysql::Session> &session) noexcept;
+
   class Bulk_load_support;
 
   class Monitoring;
 
+  class Thread_throttle;
+
   const Load_dump_options &m_options;
 
   std::unique_ptr<Dump_reader> m_dump;
@@ -717,6 +767,15 @@ class Dump_loader {
   std::atomic<std::size_t> m_unique_tables_loaded = 0;
   size_t m_total_tables_with_data = 0;
 
+  struct Table_data_completion {
+    double seconds;
+    size_t data_bytes;
+  };
+
+  // when tables and partitions finished loading, used to compare the actual
+  // completion curve of the data load with the predicted one
+  std::vector<Table_data_completion> m_table_data_completions;
+
   size_t m_data_bytes_previously_loaded = 0;
   size_t m_rows_previously_loaded = 0;
   import_table::Stats m_stats;
@@ -758,6 +817,9 @@ class Dump_loader {
   std::unordered_map<std::string, bool> m_schema_ddl_ready;
   std::unordered_map<std::string, uint64_t> m_ddl_in_progress_per_schema;
 
+  // REST transport statistics when the load started
+  mysqlshdk::rest::Transport_stats m_transport_stats;
+
   // progress thread needs to be placed after any of the fields it uses, in
   // order to ensure that it is destroyed (and stopped) before any of those
   // fields
@@ -777,6 +839,11 @@ class Dump_loader {
   std::string m_temp_table_prefix;
   std::atomic<uint64_t> m_temp_table_suffix{0};
 
+  // needs to outlive m_monitoring, which is using it
+  std::unique_ptr<Thread_throttle> m_thread_throttle;
+  // maximum total weight of the tasks which are executed at the same time
+  std::atomic<uint64_t> m_thread_limit{0};
+
   std::unique_ptr<Monitoring> m_monitoring;
 
   Reconnect m_reconnect_callback;
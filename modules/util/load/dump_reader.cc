@@ -34,6 +34,7 @@
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/load/load_errors.h"
 #include "mysqlshdk/libs/db/mysql/result.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
@@ -245,6 +246,8 @@ Dump_reader::Status Dump_reader::open() {
     m_contents.parse_done_metadata(m_dir.get(), m_options.checksum(),
                                    m_options.base_session());
     m_dump_status = Status::COMPLETE;
+
+    load_manifest();
   } else {
     log_info("@.done.json: not found");
     m_dump_status = Status::DUMPING;
@@ -279,14 +282,14 @@ bool Dump_reader::next_schema_and_tables(
 
       for (const auto &t : s->tables) {
         out_tables->emplace_back(
-            t.first,
-            t.second->has_sql ? m_dir->file(t.second->script_name()) : nullptr);
+            t.first, t.second->has_sql ? script_file(t.second->script_name())
+                                       : nullptr);
       }
 
       if (s->has_view_sql) {
         for (const auto &v : s->views) {
           out_view_placeholders->emplace_back(v.name,
-                                              m_dir->file(v.pre_script_name()));
+                                              script_file(v.pre_script_name()));
         }
       }
 
@@ -313,7 +316,7 @@ bool Dump_reader::next_schema_and_views(std::string *out_schema,
 
       if (s->has_view_sql) {
         for (const auto &v : s->views) {
-          out_views->emplace_back(v.name, m_dir->file(v.script_name()));
+          out_views->emplace_back(v.name, script_file(v.script_name()));
         }
       }
 
@@ -396,7 +399,7 @@ void Dump_reader::schema_table_triggers(
   for (const auto &t : s->tables) {
     if (t.second->has_triggers)
       out_table_triggers->emplace_back(
-          t.first, m_dir->file(t.second->triggers_script_name()));
+          t.first, script_file(t.second->triggers_script_name()));
   }
 }
 
@@ -454,7 +457,7 @@ std::string Dump_reader::fetch_schema_script(const std::string &schema) const {
 
   if (s->has_sql) {
     // Get the base script for the schema
-    script = fetch_file(m_dir.get(), s->script_name());
+    script = fetch_file(s->script_name());
   }
 
   return script;
@@ -479,6 +482,12 @@ std::string Dump_reader::fetch_schema_script(const std::string &schema) const {
 // Thus, smaller tables must get fewer threads allocated so they take longer
 // to load, while bigger threads get more, with the hope that the total time
 // to load all tables is minimized.
+//
+// The total time is bound by the table which takes the longest to load, so
+// tables are compared using the amount of data which remains to be loaded,
+// including chunks which are not yet available (if dump metadata has this
+// information): the largest tables are started first and get the most
+// threads, while the smaller ones fill the gaps.
 Dump_reader::Candidate Dump_reader::schedule_chunk_proportionally(
     const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
     std::unordered_set<Dump_reader::Table_data_info *> *tables_with_data,
@@ -501,7 +510,7 @@ Dump_reader::Candidate Dump_reader::schedule_chunk_proportionally(
         // table is better if it's bigger and in the same state as the current
         // best, or if it was previously scheduled and current best was not
         if (best == end ||
-            ((*it)->bytes_available() > (*best)->bytes_available() &&
+            ((*it)->bytes_remaining() > (*best)->bytes_remaining() &&
              !(*it)->chunks_consumed == !(*best)->chunks_consumed) ||
             ((*it)->chunks_consumed && !(*best)->chunks_consumed))
           best = it;
@@ -537,17 +546,17 @@ Dump_reader::Candidate Dump_reader::schedule_chunk_proportionally(
 
   std::vector<std::pair<Candidate, double>> candidate_weights;
 
-  // calc ratio of data available per table / total data available
-  double total_bytes_available = std::accumulate(
+  // calc ratio of data remaining per table / total data remaining
+  double total_bytes_remaining = std::accumulate(
       tables_in_progress.begin(), tables_in_progress.end(),
       static_cast<size_t>(0),
-      [](size_t size, auto it) { return size + (*it)->bytes_available(); });
-  if (total_bytes_available > 0) {
+      [](size_t size, auto it) { return size + (*it)->bytes_remaining(); });
+  if (total_bytes_remaining > 0) {
     for (auto it = tables_in_progress.begin(); it != tables_in_progress.end();
          ++it) {
       candidate_weights.emplace_back(
-          *it, static_cast<double>((**it)->bytes_available()) /
-                   total_bytes_available);
+          *it, static_cast<double>((**it)->bytes_remaining()) /
+                   total_bytes_remaining);
     }
   } else {
     // it's possible that all files loaded so far are empty, return any table
@@ -606,6 +615,17 @@ bool Dump_reader::next_table_chunk(
                                                     out_chunk->compression);
     out_chunk->file_size = info->size();
     out_chunk->data_size = data_size_in_file(info->name());
+    out_chunk->rows = rows_in_file(info->name());
+
+    if (const auto range = m_contents.chunk_ranges.find(info->name());
+        m_contents.chunk_ranges.end() != range) {
+      out_chunk->range_begin = range->second.first;
+      out_chunk->range_end = range->second.second;
+    } else {
+      out_chunk->range_begin.clear();
+      out_chunk->range_end.clear();
+    }
+
     out_chunk->options = (*iter)->owner->options;
     out_chunk->dump_complete = (*iter)->data_dumped();
     out_chunk->basename = (*iter)->basename;
@@ -623,19 +643,34 @@ bool Dump_reader::next_table_chunk(
 bool Dump_reader::next_deferred_index(
     std::string *out_schema, std::string *out_table,
     compatibility::Deferred_statements::Index_info **out_indexes) {
+  // the largest tables take the longest to build their indexes, start them as
+  // soon as their data is loaded
+  Table_info *next = nullptr;
+  std::size_t next_size = 0;
+
   for (auto &schema : m_contents.schemas) {
     for (auto &table : schema.second->tables) {
       if ((!m_options.load_data() || table.second->all_data_loaded()) &&
           !table.second->indexes_scheduled) {
-        table.second->indexes_scheduled = true;
-        *out_schema = schema.second->name;
-        *out_table = table.second->name;
-        *out_indexes = &table.second->indexes;
-        return true;
+        const auto size = table_data_size(schema.first, table.second->name);
+
+        if (!next || size > next_size) {
+          next = table.second.get();
+          next_size = size;
+        }
       }
     }
   }
-  return false;
+
+  if (!next) {
+    return false;
+  }
+
+  next->indexes_scheduled = true;
+  *out_schema = next->schema;
+  *out_table = next->name;
+  *out_indexes = &next->indexes;
+  return true;
 }
 
 bool Dump_reader::next_table_analyze(std::string *out_schema,
@@ -762,6 +797,57 @@ void Dump_reader::compute_filtered_data_size() {
 
         if (t != s->second.end()) {
           m_filtered_data_size += t->second;
+
+          // metadata does not hold sizes of partitions, assume that data is
+          // distributed evenly
+          auto &data_info = table.second->data_info;
+
+          for (auto &partition : data_info) {
+            partition.data_size = t->second / data_info.size();
+          }
+        }
+      }
+    }
+  }
+}
+
+void Dump_reader::compute_chunk_data_sizes() {
+  if (m_contents.chunk_data_sizes.empty()) {
+    return;
+  }
+
+  for (const auto &schema : m_contents.schemas) {
+    for (const auto &table : schema.second->tables) {
+      for (auto &partition : table.second->data_info) {
+        if (partition.chunk_data_sizes.empty() && partition.last_chunk_seen) {
+          std::vector<size_t> sizes;
+
+          for (const auto &chunk : partition.available_chunks) {
+            if (!chunk.has_value()) {
+              break;
+            }
+
+            const auto size = m_contents.chunk_data_sizes.find(chunk->name());
+
+            if (m_contents.chunk_data_sizes.end() == size) {
+              break;
+            }
+
+            sizes.emplace_back(size->second);
+          }
+
+          if (sizes.size() == partition.available_chunks.size()) {
+            partition.chunk_data_sizes = std::move(sizes);
+          }
+        }
+
+        if (!partition.chunk_data_sizes.empty()) {
+          // exact size, replaces the estimate
+          partition.data_size = 0;
+
+          for (const auto size : partition.chunk_data_sizes) {
+            partition.data_size += size;
+          }
         }
       }
     }
@@ -794,6 +880,26 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
 
   log_debug("Finished listing files, starting rescan");
 
+  if (m_manifest) {
+    // files which were modified after the dump was created are not going to
+    // be read from the manifest, version of a file changes each time it's
+    // written, so anything but an exact match means that file was modified
+    m_manifest->remove_if([&files](const std::string &name, uint64_t size,
+                                   const std::string &version) {
+      const auto file = files.find(name);
+
+      if (files.end() != file && file->size() == size && !version.empty() &&
+          file->version() == version) {
+        return false;
+      }
+
+      log_info("%s: file was modified after the dump was created, it will be "
+               "fetched separately",
+               name.c_str());
+      return true;
+    });
+  }
+
   m_contents.rescan(m_dir.get(), files, this, progress_thread);
 
   log_debug("Rescan done");
@@ -806,6 +912,7 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
   }
 
   compute_filtered_data_size();
+  compute_chunk_data_sizes();
 }
 
 uint64_t Dump_reader::add_deferred_statements(
@@ -1388,8 +1495,8 @@ void Dump_reader::Schema_info::rescan(mysqlshdk::storage::IDirectory *dir,
           ++files_to_fetch;
 
           pool->add_task(
-              [dir, mdpath = t.second->metadata_name()]() {
-                return fetch_file(dir, mdpath);
+              [reader, mdpath = t.second->metadata_name()]() {
+                return reader->fetch_file(mdpath);
               },
               [table = t.second.get(), &files, reader](std::string &&data) {
                 table->update_metadata(data, reader);
@@ -1474,13 +1581,14 @@ void Dump_reader::Dump_info::rescan(mysqlshdk::storage::IDirectory *dir,
                                     const Files &files, Dump_reader *reader,
                                     dump::Progress_thread *progress_thread) {
   if (!sql && files.find({"@.sql"}) != files.end()) {
-    sql = std::make_unique<std::string>(fetch_file(dir, "@.sql"));
+    sql = std::make_unique<std::string>(reader->fetch_file("@.sql"));
   }
   if (!post_sql && files.find({"@.post.sql"}) != files.end()) {
-    post_sql = std::make_unique<std::string>(fetch_file(dir, "@.post.sql"));
+    post_sql = std::make_unique<std::string>(reader->fetch_file("@.post.sql"));
   }
   if (has_users && !users_sql && files.find({"@.users.sql"}) != files.end()) {
-    users_sql = std::make_unique<std::string>(fetch_file(dir, "@.users.sql"));
+    users_sql =
+        std::make_unique<std::string>(reader->fetch_file("@.users.sql"));
   }
 
   if (!md_done) {
@@ -1533,8 +1641,8 @@ void Dump_reader::Dump_info::rescan_metadata(
         ++task_producers;
 
         pool->add_task(
-            [dir, mdpath = s.second->metadata_name()]() {
-              return fetch_file(dir, mdpath);
+            [reader, mdpath = s.second->metadata_name()]() {
+              return reader->fetch_file(mdpath);
             },
             [&maybe_shutdown, schema = s.second.get(), dir, &files, reader,
              pool](std::string &&data) {
@@ -1618,6 +1726,31 @@ void Dump_reader::Dump_info::parse_done_metadata(
         chunk_data_sizes[file.first] = file.second.as_uint();
       }
     }
+
+    if (metadata->has_key("chunkFileRows")) {
+      for (const auto &file : *metadata->get_map("chunkFileRows")) {
+        chunk_rows[file.first] = file.second.as_uint();
+      }
+    }
+
+    if (metadata->has_key("chunkRanges")) {
+      const auto to_vector = [](const shcore::Value &value) {
+        std::vector<std::string> result;
+
+        for (const auto &v : *value.as_array()) {
+          result.emplace_back(v.as_string());
+        }
+
+        return result;
+      };
+
+      for (const auto &file : *metadata->get_map("chunkRanges")) {
+        const auto range = file.second.as_map();
+
+        chunk_ranges[file.first] = {to_vector(range->at("begin")),
+                                    to_vector(range->at("end"))};
+      }
+    }
   } else {
     log_warning("Dump metadata file @.done.json is invalid");
   }
@@ -1728,6 +1861,16 @@ bool Dump_reader::include_trigger(const std::string &schema,
                                                     table, trigger);
 }
 
+const std::string &Dump_reader::where(const std::string &schema,
+                                      const std::string &table) const {
+  return m_options.where(override_schema(schema), table);
+}
+
+const std::unordered_set<std::string> &Dump_reader::excluded_columns(
+    const std::string &schema, const std::string &table) const {
+  return m_options.excluded_columns(override_schema(schema), table);
+}
+
 const std::string &Dump_reader::override_schema(const std::string &s) const {
   if (!m_schema_override.has_value()) return s;
 
@@ -1918,6 +2061,18 @@ void Dump_reader::consume_table(const Table_chunk &chunk) {
   m_tables_with_data.erase(tdi);
 }
 
+void Dump_reader::reschedule_table(const Table_chunk &chunk) {
+  const auto tdi = find_partition(chunk.schema, chunk.table, chunk.partition,
+                                  "table data will be rescheduled");
+  assert(tdi->data_scheduled());
+  assert(!tdi->chunks_loaded);
+  tdi->chunks_consumed = 0;
+
+  if (tdi->has_data_available()) {
+    m_tables_with_data.emplace(tdi);
+  }
+}
+
 size_t Dump_reader::partition_file_size(const std::string &schema,
                                         const std::string &table,
                                         const std::string &partition) const {
@@ -1960,6 +2115,31 @@ size_t Dump_reader::partition_data_size(const std::string &schema,
   return size;
 }
 
+std::vector<std::unique_ptr<mysqlshdk::storage::IFile>>
+Dump_reader::partition_files(const std::string &schema,
+                             const std::string &table,
+                             const std::string &partition) const {
+  const auto tdi =
+      find_partition(schema, table, partition, "files will be listed");
+  assert(tdi->data_dumped());
+  std::vector<std::unique_ptr<mysqlshdk::storage::IFile>> files;
+
+  files.reserve(tdi->available_chunks.size());
+
+  for (const auto &file : tdi->available_chunks) {
+    if (!file.has_value()) {
+      throw std::logic_error("Trying to use chunk of " +
+                             schema_table_object_key(schema, table, partition) +
+                             " which is not yet available");
+    }
+
+    files.emplace_back(mysqlshdk::storage::make_file(
+        m_dir->file(file->name()), tdi->owner->compression));
+  }
+
+  return files;
+}
+
 uint64_t Dump_reader::data_size_in_file(const std::string &filename) const {
   if (const auto it = m_contents.chunk_data_sizes.find(filename);
       m_contents.chunk_data_sizes.end() != it) {
@@ -1975,4 +2155,65 @@ uint64_t Dump_reader::data_size_in_file(const std::string &filename) const {
   }
 }
 
+std::optional<uint64_t> Dump_reader::rows_in_file(
+    const std::string &filename) const {
+  if (const auto it = m_contents.chunk_rows.find(filename);
+      m_contents.chunk_rows.end() != it) {
+    return it->second;
+  }
+
+  // @.done.json not there yet
+  return {};
+}
+
+void Dump_reader::load_manifest() {
+  const auto file =
+      m_dir->file(std::string{dump::common::k_dump_manifest_file});
+
+  if (!file->exists()) {
+    log_info("%s: not found, metadata files will be fetched separately",
+             file->filename().c_str());
+    return;
+  }
+
+  try {
+    m_manifest =
+        std::make_unique<dump::common::Dump_manifest_reader>(file.get());
+    log_info("Dump manifest with %zu entries loaded", m_manifest->size());
+  } catch (const std::exception &e) {
+    log_warning(
+        "Failed to load the dump manifest, metadata files will be fetched "
+        "separately: %s",
+        e.what());
+  }
+}
+
+std::string Dump_reader::fetch_file(const std::string &name) const {
+  if (m_manifest) {
+    if (auto contents = m_manifest->fetch(name)) {
+      return std::move(*contents);
+    }
+
+    log_debug("%s: not in the dump manifest, fetching the file", name.c_str());
+  }
+
+  return mysqlsh::fetch_file(m_dir.get(), name);
+}
+
+std::shared_ptr<mysqlshdk::storage::IFile> Dump_reader::script_file(
+    const std::string &name) const {
+  if (m_manifest) {
+    if (auto contents = m_manifest->fetch(name)) {
+      auto file =
+          std::make_shared<mysqlshdk::storage::backend::Memory_file>(name);
+      file->set_content(*contents);
+      return file;
+    }
+
+    log_debug("%s: not in the dump manifest, fetching the file", name.c_str());
+  }
+
+  return m_dir->file(name);
+}
+
 }  // namespace mysqlsh
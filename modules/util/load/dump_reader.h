@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "modules/util/common/dump/checksums.h"
+#include "modules/util/common/dump/dump_manifest.h"
 #include "modules/util/dump/compatibility.h"
 #include "modules/util/dump/progress_thread.h"
 
@@ -169,6 +170,11 @@ class Dump_reader {
     ssize_t index = 0;
     size_t file_size = 0;
     size_t data_size = 0;
+    // number of rows in this chunk, if known
+    std::optional<uint64_t> rows;
+    // values of the index columns which delimit this chunk, empty if not known
+    std::vector<std::string> range_begin;
+    std::vector<std::string> range_end;
     size_t chunks_total = 0;
     shcore::Dictionary_t options;
     bool dump_complete = false;
@@ -232,6 +238,13 @@ class Dump_reader {
                              const std::string &table,
                              const std::string &partition) const;
 
+  /**
+   * All chunk files of a partition, in order.
+   */
+  std::vector<std::unique_ptr<mysqlshdk::storage::IFile>> partition_files(
+      const std::string &schema, const std::string &table,
+      const std::string &partition) const;
+
   uint64_t bytes_per_chunk() const { return m_contents.bytes_per_chunk; }
 
   void rescan(dump::Progress_thread *progress_thread = nullptr);
@@ -285,6 +298,11 @@ class Dump_reader {
   bool include_trigger(const std::string &schema, const std::string &table,
                        const std::string &trigger) const;
 
+  const std::string &where(const std::string &schema,
+                           const std::string &table) const;
+  const std::unordered_set<std::string> &excluded_columns(
+      const std::string &schema, const std::string &table) const;
+
   /**
    * Returns true if all data for this table/partition was loaded.
    */
@@ -309,6 +327,12 @@ class Dump_reader {
 
   void consume_table(const Table_chunk &chunk);
 
+  /**
+   * Reverts consume_table(), chunks of the table are going to be scheduled
+   * again.
+   */
+  void reschedule_table(const Table_chunk &chunk);
+
   struct Capability_info {
     std::string id;
     std::string description;
@@ -357,6 +381,12 @@ class Dump_reader {
     size_t chunks_consumed = 0;
     // number of chunks which were loaded
     size_t chunks_loaded = 0;
+    // uncompressed size of data, as reported by the dump metadata, 0 if not
+    // known
+    size_t data_size = 0;
+    // uncompressed size of data of each chunk, as reported by the dump
+    // metadata, empty if not known
+    std::vector<size_t> chunk_data_sizes;
 
     std::list<const dump::common::Checksums::Checksum_data *> checksums;
     size_t checksums_verified = 0;
@@ -386,6 +416,33 @@ class Dump_reader {
       return total;
     }
 
+    /**
+     * Estimated amount of data which still needs to be scheduled. Uses the
+     * size from the dump metadata when it's known, this includes the data
+     * which is not yet available.
+     */
+    size_t bytes_remaining() const {
+      if (!chunk_data_sizes.empty()) {
+        size_t total = 0;
+
+        for (size_t i = chunks_consumed, s = chunk_data_sizes.size(); i < s;
+             ++i) {
+          total += chunk_data_sizes[i];
+        }
+
+        return total;
+      }
+
+      if (!data_size || !last_chunk_seen || available_chunks.empty()) {
+        return bytes_available();
+      }
+
+      return static_cast<size_t>(
+          static_cast<double>(data_size) *
+          (available_chunks.size() - chunks_consumed) /
+          available_chunks.size());
+    }
+
     bool data_dumped() const { return all_chunks_are(chunks_seen); }
 
     bool data_scheduled() const { return all_chunks_are(chunks_consumed); }
@@ -531,6 +588,11 @@ class Dump_reader {
     std::string origin;
     uint64_t bytes_per_chunk = 0;
     std::unordered_map<std::string, uint64_t> chunk_data_sizes;
+    std::unordered_map<std::string, uint64_t> chunk_rows;
+    // path -> first and last value of the index
+    std::unordered_map<std::string, std::pair<std::vector<std::string>,
+                                              std::vector<std::string>>>
+        chunk_ranges;
 
     volatile bool md_done = false;
 
@@ -598,8 +660,33 @@ class Dump_reader {
 
   uint64_t data_size_in_file(const std::string &filename) const;
 
+  std::optional<uint64_t> rows_in_file(const std::string &filename) const;
+
+  /**
+   * Sets the sizes of the chunks of each table, once they are all known.
+   */
+  void compute_chunk_data_sizes();
+
+  void load_manifest();
+
+  /**
+   * Fetches contents of the given metadata or DDL file, uses the dump manifest
+   * if it's available.
+   */
+  std::string fetch_file(const std::string &name) const;
+
+  /**
+   * Provides handle to the given DDL file, if dump manifest is available, its
+   * contents are served from memory.
+   */
+  std::shared_ptr<mysqlshdk::storage::IFile> script_file(
+      const std::string &name) const;
+
   std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
 
+  // if available, holds all metadata files and DDL scripts
+  std::unique_ptr<dump::common::Dump_manifest_reader> m_manifest;
+
   const Load_dump_options &m_options;
 
   Status m_dump_status = Status::INVALID;
@@ -633,6 +720,8 @@ class Dump_reader {
 
 #ifdef FRIEND_TEST
   FRIEND_TEST(Dump_scheduler, load_scheduler);
+  FRIEND_TEST(Dump_scheduler, largest_tables_first);
+  FRIEND_TEST(Dump_scheduler, chunk_data_sizes);
 #endif
 };
 
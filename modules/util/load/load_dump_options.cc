@@ -84,6 +84,7 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
           .optional("threads", &Load_dump_options::m_threads_count)
           .optional("backgroundThreads",
                     &Load_dump_options::m_background_threads_count)
+          .optional("minThreads", &Load_dump_options::m_min_threads_count)
           .optional("showProgress", &Load_dump_options::m_show_progress)
           .optional("waitDumpTimeout", &Load_dump_options::set_wait_timeout)
           .optional("loadData", &Load_dump_options::m_load_data)
@@ -102,6 +103,8 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
                    &Filtering_options::tables)
           .include(&Load_dump_options::m_filtering_options,
                    &Filtering_options::triggers)
+          .optional("where", &Load_dump_options::set_where_clause)
+          .optional("excludeColumns", &Load_dump_options::set_excluded_columns)
           .optional("characterSet", &Load_dump_options::m_character_set)
           .optional("skipBinlog", &Load_dump_options::m_skip_binlog)
           .optional("ignoreExistingObjects",
@@ -284,12 +287,19 @@ void Load_dump_options::set_session(
     // innodb_ddl_threads threads are used during second and third stages, in
     // most cases first stage is executed before the rest, so we're using
     // maximum of these two values
-    m_threads_per_add_index =
+    const auto row =
         query(
-            "SELECT GREATEST(@@innodb_parallel_read_threads, "
-            "@@innodb_ddl_threads)")
-            ->fetch_one_or_throw()
-            ->get_uint(0);
+            "SELECT @@innodb_parallel_read_threads, @@innodb_ddl_threads, "
+            "@@innodb_ddl_buffer_size")
+            ->fetch_one_or_throw();
+
+    m_add_index_limits.parallel_read_threads = row->get_uint(0);
+    m_add_index_limits.ddl_threads = row->get_uint(1);
+    m_add_index_limits.ddl_buffer_size = row->get_uint(2);
+
+    m_threads_per_add_index =
+        std::max(m_add_index_limits.parallel_read_threads,
+                 m_add_index_limits.ddl_threads);
   }
 
   if (m_target_server_version >= Version(8, 0, 16)) {
@@ -448,6 +458,13 @@ void Load_dump_options::on_unpacked_options() {
         "enabled");
   }
 
+  if (m_min_threads_count.has_value() &&
+      (0 == *m_min_threads_count || *m_min_threads_count > m_threads_count)) {
+    throw std::invalid_argument(
+        "The value of the 'minThreads' option must be a positive integer not "
+        "greater than the value of the 'threads' option.");
+  }
+
   if (!m_load_indexes && m_defer_table_indexes == Defer_index_mode::OFF) {
     throw std::invalid_argument(
         "'deferTableIndexes' option needs to be enabled when "
@@ -484,6 +501,12 @@ void Load_dump_options::on_unpacked_options() {
   if (has_conflicts) {
     throw std::invalid_argument("Conflicting filtering options");
   }
+
+  if (m_checksum && (!m_where.empty() || !m_excluded_columns.empty())) {
+    throw std::invalid_argument(
+        "The 'checksum' option cannot be used when the 'where' or "
+        "'excludeColumns' option is set.");
+  }
 }
 
 void Load_dump_options::on_log_options(const char *msg) const {
@@ -549,6 +572,95 @@ void Load_dump_options::set_handle_grant_errors(const std::string &action) {
   }
 }
 
+void Load_dump_options::set_where_clause(
+    const std::map<std::string, std::string> &where) {
+  std::string schema;
+  std::string table;
+
+  for (const auto &w : where) {
+    if (w.second.empty()) {
+      continue;
+    }
+
+    schema.clear();
+    table.clear();
+
+    shcore::parse_schema_and_object(w.first,
+                                    "table name key of the 'where' option",
+                                    "table", &schema, &table);
+
+    m_where[schema][table] =
+        dump::common::validate_where_clause(schema, table, w.second);
+  }
+}
+
+void Load_dump_options::set_excluded_columns(
+    const std::vector<std::string> &columns) {
+  std::string schema;
+  std::string table;
+  std::string column;
+
+  for (const auto &c : columns) {
+    schema.clear();
+    table.clear();
+    column.clear();
+
+    try {
+      shcore::split_schema_table_and_object(c, &schema, &table, &column);
+    } catch (const std::runtime_error &e) {
+      throw std::invalid_argument("Failed to parse column to be excluded '" +
+                                  c + "': " + e.what());
+    }
+
+    if (schema.empty()) {
+      throw std::invalid_argument(
+          "The column to be excluded must be in the following form: "
+          "schema.table.column, with optional backtick quotes, wrong value: '" +
+          c + "'.");
+    }
+
+    m_excluded_columns[schema][table].emplace(std::move(column));
+  }
+}
+
+const std::string &Load_dump_options::where(const std::string &schema,
+                                            const std::string &table) const {
+  static std::string def;
+
+  const auto s = m_where.find(schema);
+
+  if (m_where.end() == s) {
+    return def;
+  }
+
+  const auto t = s->second.find(table);
+
+  if (s->second.end() == t) {
+    return def;
+  }
+
+  return t->second;
+}
+
+const std::unordered_set<std::string> &Load_dump_options::excluded_columns(
+    const std::string &schema, const std::string &table) const {
+  static std::unordered_set<std::string> def;
+
+  const auto s = m_excluded_columns.find(schema);
+
+  if (m_excluded_columns.end() == s) {
+    return def;
+  }
+
+  const auto t = s->second.find(table);
+
+  if (s->second.end() == t) {
+    return def;
+  }
+
+  return t->second;
+}
+
 void Load_dump_options::set_storage_config(
     std::shared_ptr<mysqlshdk::storage::Config> storage_config) {
   m_storage_config = std::move(storage_config);
@@ -560,11 +672,6 @@ void Load_dump_options::configure_bulk_load() {
     return;
   }
 
-  if (Bulk_load_fs::UNSUPPORTED == m_bulk_load_info.fs) {
-    log_info("BULK LOAD: unsupported FS");
-    return;
-  }
-
   if (m_target_server_version < Version(8, 4, 0)) {
     // minimum version which supports required syntax is 8.4.0
     log_info("BULK LOAD: unsupported version");
@@ -595,10 +702,20 @@ void Load_dump_options::configure_bulk_load() {
                 .has_missing_privileges();
   };
 
+  // if server cannot read the dump files, data is streamed by the client
+  const auto use_local_input = [this](const char *reason) {
+    log_info("BULK LOAD: %s, using LOCAL input", reason);
+    m_bulk_load_info.fs = Bulk_load_fs::LOCAL;
+    m_bulk_load_info.file_prefix.clear();
+  };
+
+  DBUG_EXECUTE_IF("dump_loader_bulk_local_input",
+                  { m_bulk_load_info.fs = Bulk_load_fs::UNSUPPORTED; });
+
   switch (m_bulk_load_info.fs) {
     case Bulk_load_fs::UNSUPPORTED:
-      log_info("BULK LOAD: unsupported FS");
-      return;
+      use_local_input("unsupported FS");
+      break;
 
     case Bulk_load_fs::INFILE:
       // NOTE: this is for testing purposes only, validation is superficial
@@ -608,8 +725,8 @@ void Load_dump_options::configure_bulk_load() {
         if (mysqlshdk::db::Transport_type::Tcp == co.get_transport_type() &&
             !mysqlshdk::utils::Net::is_local_address(co.get_host())) {
           // in order to use INFILE we need to be connected to the local host
-          log_info("BULK LOAD: local FS and a remote host");
-          return;
+          use_local_input("local FS and a remote host");
+          break;
         }  // else we're connected via socket, pipe or to a local TCP address
       }
 
@@ -624,37 +741,35 @@ void Load_dump_options::configure_bulk_load() {
                   mysqlshdk::storage::make_directory(*path, storage_config())
                       ->full_path()
                       .real())) {
-            log_info(
-                "BULK LOAD: local FS and dump is not a subdirectory of "
+            use_local_input(
+                "local FS and dump is not a subdirectory of "
                 "'secure_file_priv'");
-            return;
           }
         }  // else path is empty, files can be loaded from anywhere
       } else {
         // variable is set to NULL, LOAD DATA INFILE is disabled
-        log_info("BULK LOAD: local FS and 'secure_file_priv' is NULL");
-        return;
+        use_local_input("local FS and 'secure_file_priv' is NULL");
       }
 
       break;
 
     case Bulk_load_fs::URL:
       if (!has_privilege("LOAD_FROM_URL")) {
-        log_info(
-            "BULK LOAD: OCI prefix PAR and 'LOAD_FROM_URL' privilege is "
-            "missing");
-        return;
+        use_local_input(
+            "OCI prefix PAR and 'LOAD_FROM_URL' privilege is missing");
       }
 
       break;
 
     case Bulk_load_fs::S3:
       if (!has_privilege("LOAD_FROM_S3")) {
-        log_info("BULK LOAD: AWS S3 and 'LOAD_FROM_S3' privilege is missing");
-        return;
+        use_local_input("AWS S3 and 'LOAD_FROM_S3' privilege is missing");
       }
 
       break;
+
+    case Bulk_load_fs::LOCAL:
+      break;
   }
 
   // BULK LOAD is supported
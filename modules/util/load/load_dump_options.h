@@ -26,10 +26,12 @@
 #ifndef MODULES_UTIL_LOAD_LOAD_DUMP_OPTIONS_H_
 #define MODULES_UTIL_LOAD_LOAD_DUMP_OPTIONS_H_
 
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -95,7 +97,8 @@ class Load_dump_options {
 
   enum class Handle_grant_errors { ABORT, DROP_ACCOUNT, IGNORE };
 
-  enum class Bulk_load_fs { UNSUPPORTED, INFILE, URL, S3 };
+  // LOCAL - server cannot access the dump, data is streamed by the client
+  enum class Bulk_load_fs { UNSUPPORTED, INFILE, URL, S3, LOCAL };
 
   struct Bulk_load_info {
     bool enabled = false;
@@ -164,6 +167,18 @@ class Load_dump_options {
 
   uint64_t threads_count() const { return m_threads_count; }
 
+  uint64_t min_threads_count() const {
+    return m_min_threads_count.value_or(m_threads_count);
+  }
+
+  /**
+   * Whether the number of threads loading the data is adjusted depending on
+   * the load of the destination server.
+   */
+  bool adaptive_threads() const {
+    return min_threads_count() < threads_count();
+  }
+
   uint64_t background_threads_count(uint64_t def) const {
     return m_background_threads_count.value_or(def);
   }
@@ -172,8 +187,22 @@ class Load_dump_options {
     m_background_threads_count = count;
   }
 
+  /**
+   * Server-wide settings used by ALTER TABLE ... ADD INDEX, all zeros if target
+   * server does not support parallel index creation.
+   */
+  struct Add_index_limits {
+    uint64_t parallel_read_threads = 0;
+    uint64_t ddl_threads = 0;
+    uint64_t ddl_buffer_size = 0;
+  };
+
   uint64_t threads_per_add_index() const { return m_threads_per_add_index; }
 
+  const Add_index_limits &add_index_limits() const {
+    return m_add_index_limits;
+  }
+
   uint64_t dump_wait_timeout_ms() const { return m_wait_dump_timeout_ms; }
 
   void set_dump_wait_timeout_ms(uint64_t timeout_ms) {
@@ -268,6 +297,19 @@ class Load_dump_options {
     return m_bulk_load_info;
   }
 
+  /**
+   * Condition used to filter rows of the given table, empty if all rows are
+   * loaded.
+   */
+  const std::string &where(const std::string &schema,
+                           const std::string &table) const;
+
+  /**
+   * Columns of the given table which are not loaded.
+   */
+  const std::unordered_set<std::string> &excluded_columns(
+      const std::string &schema, const std::string &table) const;
+
  private:
   void set_wait_timeout(const double &timeout_seconds);
 
@@ -275,6 +317,10 @@ class Load_dump_options {
 
   void set_handle_grant_errors(const std::string &action);
 
+  void set_where_clause(const std::map<std::string, std::string> &where);
+
+  void set_excluded_columns(const std::vector<std::string> &columns);
+
   inline std::shared_ptr<mysqlshdk::db::IResult> query(
       std::string_view sql) const {
     return m_base_session->query(sql);
@@ -289,6 +335,7 @@ class Load_dump_options {
   std::string m_url;
   uint64_t m_threads_count = 4;
   std::optional<uint64_t> m_background_threads_count;
+  std::optional<uint64_t> m_min_threads_count;
   bool m_show_progress = isatty(fileno(stdout)) ? true : false;
 
   mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
@@ -337,6 +384,7 @@ class Load_dump_options {
 
   // how many threads are used by the server per one ALTER TABLE ... ADD INDEX
   uint64_t m_threads_per_add_index = 1;
+  Add_index_limits m_add_index_limits;
 
   bool m_checksum = false;
 
@@ -346,6 +394,16 @@ class Load_dump_options {
   bool m_use_fast_sub_chunking = false;
 
   Bulk_load_info m_bulk_load_info;
+
+  // schema -> table -> condition
+  std::unordered_map<std::string, std::unordered_map<std::string, std::string>>
+      m_where;
+
+  // schema -> table -> columns
+  std::unordered_map<
+      std::string,
+      std::unordered_map<std::string, std::unordered_set<std::string>>>
+      m_excluded_columns;
 };
 
 }  // namespace mysqlsh
@@ -1070,7 +1070,10 @@ MySQL global setting must be enabled.
 
 If target MySQL server supports BULK LOAD, the load operation of compatible
 tables can be offloaded to the target server, which parallelizes and loads data
-directly from the Cloud storage.
+directly from the Cloud storage. If target server cannot access the dump files,
+data of tables with a primary key is streamed by the client using LOAD DATA
+LOCAL INFILE, and still loaded using BULK LOAD, if both server and table support
+it.
 
 <b>Resuming</b>
 
@@ -1126,6 +1129,11 @@ only full-text indexes will be deferred.
 feature to load the data, even when available.
 @li <b>dryRun</b>: bool (default: false) - Scans the dump and prints everything
 that would be performed, without actually doing so.
+@li <b>excludeColumns</b>: array of strings (default not set) - Skip loading
+data of the specified columns, these are set to their default values instead.
+Strings are in format <b>schema</b>.<b>table</b>.<b>column</b>, quoted using
+backtick characters when required. Tables with excluded columns are not BULK
+LOADED. Cannot be used together with the <b>checksum</b> option.
 @li <b>excludeEvents</b>: array of strings (default not set) - Skip loading
 specified events from the dump. Strings are in format <b>schema</b>.<b>event</b>,
 quoted using backtick characters when required.
@@ -1197,6 +1205,12 @@ LOAD DATA statement. Supports unit suffixes: k (kilobytes), M (Megabytes), G
 the value of the <b>bytesPerChunk</b> dump option is used, but only in case of
 the files with data size greater than <b>1.5 * bytesPerChunk</b>. Not used if
 table is BULK LOADED.
+@li <b>minThreads</b>: int (default not set) - If set, the number of threads
+which are loading the data is adjusted during the load, between this value and
+the value of the <b>threads</b> option. It is reduced when the destination
+server is under pressure (i.e. InnoDB is waiting for free pages in the buffer
+pool or the redo log is almost full), and increased as long as this improves the
+throughput.
 @li <b>progressFile</b>: path (default: load-progress.@<server_uuid@>.progress)
 - Stores load progress information in the given local file path.
 @li <b>resetProgress</b>: bool (default: false) - Discards progress information
@@ -1223,6 +1237,13 @@ being created. Once all uploaded tables are processed the command will either
 wait for more data, the dump is marked as completed or the given timeout (in
 seconds) passes.
 <= 0 disables waiting.
+@li <b>where</b>: dictionary (default: not set) - A key-value pair of a table
+name in the format of <b>schema.table</b> and a valid SQL condition expression
+used to filter the rows being loaded. Each chunk of such table is loaded into a
+temporary table first, then rows matching the condition are copied to the
+destination table. Condition may refer to the columns specified by the
+<b>excludeColumns</b> option. Tables with a condition are not BULK LOADED.
+Cannot be used together with the <b>checksum</b> option.
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
 ${TOPIC_UTIL_AWS_COMMON_OPTIONS}
 ${TOPIC_UTIL_AZURE_COMMON_OPTIONS}
@@ -1560,14 +1581,22 @@ compatibility issues with MySQL HeatWave Service.
 @li <b>chunking</b>: bool (default: true) - Enable chunking of the tables.
 @li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
 number of bytes to be written to each chunk file, enables <b>chunking</b>.
+@li <b>adaptiveChunking</b>: bool (default: false) - Adjust the number of rows
+per chunk while a table is being chunked, using the average size of rows which
+were already dumped, so that the size of chunk files is closer to
+<b>bytesPerChunk</b>.
 @li <b>threads</b>: int (default: 4) - Use N threads to dump data chunks from
 the server.
+@li <b>ddlThreads</b>: int (default: 0) - Use N additional threads, each with
+its own connection, to dump the DDL of schemas, tables and views. If set to 0,
+DDL is dumped by the threads which dump the data.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_DDL_COMPRESSION, R"*(
 @li <b>compression</b>: string (default: "zstd;level=1") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd". Compression level may be
-specified as "gzip;level=8" or "zstd;level=8".
+the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression level
+may be specified as "gzip;level=8", "zstd;level=8" or "lz4;level=N", where N is
+0-12.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_MDS_COMMON_OPTIONS, R"*(
@@ -1820,11 +1849,20 @@ to be overwritten. The output file is created with the following access rights
 used to filter the data being exported.
 @li <b>partitions</b>: list of strings (default: not set) - A list of valid
 partition names used to limit the data export to just the specified partitions.
+@li <b>threads</b>: int (default: 1) - Use N threads to export the table data.
+If set to a value greater than 1, the table is split into chunks, which are
+exported in parallel to temporary files and then merged in order into the output
+file. In this case, all threads use a consistent snapshot of the data, which
+requires the table to be briefly locked.
+@li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
+number of bytes to be written to each chunk, used only if <b>threads</b> is
+greater than 1.
 
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
 @li <b>compression</b>: string (default: "none") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd". Compression level may be
-specified as "gzip;level=8" or "zstd;level=8".
+the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression level
+may be specified as "gzip;level=8", "zstd;level=8" or "lz4;level=N", where N is
+0-12.
 
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
 
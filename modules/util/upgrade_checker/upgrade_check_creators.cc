@@ -26,8 +26,13 @@
 #include "modules/util/upgrade_checker/upgrade_check_creators.h"
 
 #include <mysqld_error.h>
+#include <algorithm>
 #include <forward_list>
+#include <optional>
 #include <regex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "modules/util/upgrade_checker/feature_life_cycle_check.h"
@@ -38,6 +43,7 @@
 #include "mysqlshdk/libs/db/result.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/parser/mysql_parser_utils.h"
+#include "mysqlshdk/libs/utils/thread_pool.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -171,71 +177,124 @@ class Routine_syntax_check : public Upgrade_check {
              qh.schema_and_event_filter(),
          "SHOW CREATE EVENT !.!", 3, Upgrade_issue::Object_type::EVENT}};
 
-    std::vector<Upgrade_issue> issues;
+    // objects in the order they were fetched
+    std::vector<Upgrade_issue> objects;
+    // index of the object which was the first one to use the given definition
+    std::vector<std::size_t> first_with_definition;
+    std::unordered_map<std::string, std::size_t> definitions;
+    // index of the object -> result of its syntax check, written in the
+    // thread which executes the processing part of the pool's tasks
+    std::vector<std::pair<std::size_t, std::string>> results;
+
+    // definitions are fetched in this thread, while their syntax is checked
+    // in the thread pool; pool is declared last, so that its threads are
+    // stopped before the data above is destroyed
+    shcore::Thread_pool pool{
+        std::max<uint64_t>(1, std::thread::hardware_concurrency())};
+
+    pool.start_threads();
+    pool.process_async();
+
     for (const auto &obj : object_info) {
       auto result = session->queryf(obj.names_query);
 
-      // fetch all results because we need to query again in process_item()
+      // fetch all results because we need to query again for each object
       result->buffer();
 
       while (auto row = result->fetch_one()) {
-        auto issue = process_item(row, obj.show_query, obj.code_field,
-                                  obj.object_type, session.get());
-        if (!issue.description.empty()) issues.push_back(std::move(issue));
+        auto object = create_issue();
+
+        object.schema = row->get_as_string(0);
+        object.table = row->get_as_string(1);
+        object.level = Upgrade_issue::ERROR;
+        object.object_type = obj.object_type;
+
+        const auto index = objects.size();
+        auto sql = get_definition(session.get(), obj.show_query,
+                                  obj.code_field, object.schema, object.table);
+
+        objects.emplace_back(std::move(object));
+
+        if (!sql.has_value()) {
+          first_with_definition.emplace_back(index);
+          continue;
+        }
+
+        // objects with the same definition (i.e. the same routine in multiple
+        // schemas) are checked just once
+        const auto it = definitions.try_emplace(std::move(*sql), index).first;
+
+        first_with_definition.emplace_back(it->second);
+
+        if (it->second == index) {
+          pool.add_task(
+              [&sql = it->first]() { return check_routine_syntax(sql); },
+              [index, &results](std::string &&description) {
+                results.emplace_back(index, std::move(description));
+              });
+        }
+      }
+    }
+
+    pool.tasks_done();
+    pool.wait_for_process();
+
+    std::vector<std::string> descriptions(objects.size());
+
+    for (auto &result : results) {
+      descriptions[result.first] = std::move(result.second);
+    }
+
+    std::vector<Upgrade_issue> issues;
+
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+      auto &description = descriptions[first_with_definition[i]];
+
+      if (!description.empty()) {
+        objects[i].description = description;
+        issues.emplace_back(std::move(objects[i]));
       }
     }
+
     return issues;
   }
 
  protected:
-  std::string check_routine_syntax(mysqlshdk::db::ISession *session,
-                                   const std::string &show_template,
-                                   int show_sql_field,
-                                   const std::string &schema,
-                                   const std::string &name) {
+  std::optional<std::string> get_definition(mysqlshdk::db::ISession *session,
+                                            const std::string &show_template,
+                                            int show_sql_field,
+                                            const std::string &schema,
+                                            const std::string &name) {
+    // we need to get routine definitions with the SHOW command
+    // because INFORMATION_SCHEMA will eat up things like backslashes
+    // Bug#34534696	unparseable code returned in
+    // INFORMATION_SCHEMA.ROUTINES.ROUTINE_DEFINITION
     auto result = session->queryf(show_template, schema, name);
+
     if (auto row = result->fetch_one()) {
-      std::string sql = row->get_as_string(show_sql_field);
-      try {
-        sql = "DELIMITER $$$\n" + sql + "$$$\n";
-
-        mysqlshdk::parser::check_sql_syntax(sql);
-      } catch (const mysqlshdk::parser::Sql_syntax_error &err) {
-        return shcore::str_format("at line %i,%i: unexpected token '%s'",
-                                  static_cast<int>(err.line() - 1),
-                                  static_cast<int>(err.offset()),
-                                  err.token_text().c_str());
-      }
+      return row->get_as_string(show_sql_field);
     } else {
       log_warning("Upgrade check query %s returned no rows for %s.%s",
                   show_template.c_str(), schema.c_str(), name.c_str());
     }
 
-    return "";
+    return {};
   }
 
-  Upgrade_issue process_item(const mysqlshdk::db::IRow *row,
-                             const std::string &show_template,
-                             int show_sql_field,
-                             Upgrade_issue::Object_type object_type,
-                             mysqlshdk::db::ISession *session) {
-    auto issue = create_issue();
-
-    issue.schema = row->get_as_string(0);
-    issue.table = row->get_as_string(1);
-    issue.level = Upgrade_issue::ERROR;
-    issue.object_type = object_type;
-
-    // we need to get routine definitions with the SHOW command
-    // because INFORMATION_SCHEMA will eat up things like backslashes
-    // Bug#34534696	unparseable code returned in
-    // INFORMATION_SCHEMA.ROUTINES.ROUTINE_DEFINITION
-
-    issue.description = check_routine_syntax(
-        session, show_template, show_sql_field, issue.schema, issue.table);
+  static std::string check_routine_syntax(const std::string &sql) {
+    // each thread of the pool reuses its own lexer and parser
+    thread_local mysqlshdk::parser::Sql_syntax_checker checker;
+
+    try {
+      checker.check("DELIMITER $$$\n" + sql + "$$$\n");
+    } catch (const mysqlshdk::parser::Sql_syntax_error &err) {
+      return shcore::str_format("at line %i,%i: unexpected token '%s'",
+                                static_cast<int>(err.line() - 1),
+                                static_cast<int>(err.offset()),
+                                err.token_text().c_str());
+    }
 
-    if (issue.description.empty()) return {};
-    return issue;
+    return "";
   }
 };
 
@@ -32,6 +32,7 @@
 #define SN_SHELL_OPTION_CHANGED "SN_SHELL_OPTION_CHANGED"
 
 #define SHCORE_RESULT_FORMAT "resultFormat"
+#define SHCORE_RESULT_FORMAT_TABLE_SAMPLE_ROWS "resultFormat.tableSampleRows"
 #define SHCORE_INTERACTIVE "interactive"
 #define SHCORE_SHOW_WARNINGS "showWarnings"
 #define SHCORE_BATCH_CONTINUE_ON_ERROR "batchContinueOnError"
@@ -68,6 +69,9 @@
 
 #define SHCORE_PROGRESS_REPORTING "progressReporting"
 
+#define SHCORE_REST_MAX_CONNECTIONS "rest.maxConnections"
+#define SHCORE_REST_HTTP2 "rest.http2"
+
 #include <stdlib.h>
 #include <array>
 #include <iostream>
@@ -106,6 +110,10 @@ class Shell_options final : public shcore::Options {
     std::string pwd;
     mysqlshdk::ssh::Ssh_connection_options uri_data;
   };
+
+  // default number of rows used to calculate column widths in table format
+  static constexpr int k_default_table_sample_rows = 1000;
+
   struct Storage {
     shcore::IShell_core::Mode initial_mode = shcore::IShell_core::Mode::None;
     std::string run_file;
@@ -117,6 +125,10 @@ class Shell_options final : public shcore::Options {
     std::string oci_profile;
     std::string oci_config_file;
 
+    // transport shared by the REST services (object storage, PARs)
+    int rest_max_connections = 8;
+    bool rest_http2 = false;
+
     std::string protocol;
 
     mysqlshdk::db::Connection_options connection_data;
@@ -124,13 +136,18 @@ class Shell_options final : public shcore::Options {
 
     std::string result_format;
     std::string wrap_json;
+    int table_sample_rows = k_default_table_sample_rows;
     bool force = false;
+    int sql_batch_size = 1;
     bool interactive = false;
     bool full_interactive = false;
     bool passwords_from_stdin = false;
     bool show_warnings = true;
     bool trace_protocol = false;
     bool log_to_stderr = false;
+    bool log_async = false;
+    bool startup_profile = false;
+    bool lazy_init = false;
     bool devapi_schema_object_handles = true;
     bool db_name_cache = true;
     bool db_name_cache_set = false;
@@ -148,6 +148,9 @@ class Resultset_dumper_base {
   shcore::atomic_flag m_cancelled;
   std::unique_ptr<Resultset_printer> m_printer;
   bool m_show_column_type_info;
+  // # of rows used to calculate column widths in table format, if 0 widths
+  // are calculated using column metadata
+  size_t m_table_sample_rows;
 };
 
 /**
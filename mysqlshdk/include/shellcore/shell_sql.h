@@ -32,6 +32,7 @@
 #include <utility>
 #include <vector>
 
+#include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/result.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
@@ -108,6 +109,10 @@ class SHCORE_PUBLIC Shell_sql : public Shell_language {
                    std::shared_ptr<mysqlshdk::db::ISession> session,
                    mysqlshdk::utils::Sql_splitter *splitter);
 
+  bool execute_batch(
+      const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+      std::vector<std::string> *statements, std::vector<size_t> *lines);
+
   std::pair<size_t, bool> handle_command(const char *p, size_t len, bool bol);
 
   void cmd_process_file(const std::vector<std::string> &params);
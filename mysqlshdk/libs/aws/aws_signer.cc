@@ -42,6 +42,8 @@ namespace {
 const std::string k_empty_payload_hash =
     "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
 
+const std::string k_unsigned_payload = "UNSIGNED-PAYLOAD";
+
 const std::string k_authorization_header = "Authorization";
 const std::string k_host_header = "Host";
 const std::string k_date_header = "x-amz-date";
@@ -82,6 +84,7 @@ std::string hex_sha256(const char *data, size_t size) {
 Aws_signer::Aws_signer(const S3_bucket_config &config)
     : m_host(config.host()),
       m_region(config.region()),
+      m_unsigned_payload(config.unsigned_payload()),
       m_credentials_provider(config.credentials_provider()) {
   update_credentials();
 }
@@ -116,9 +119,17 @@ rest::Headers Aws_signer::sign_request(const rest::Signed_request *request,
   }
 
   // hash of the payload - Hex(SHA256Hash(<payload>)
-  const auto &payload_hash = request->size
-                                 ? hex_sha256(request->body, request->size)
-                                 : k_empty_payload_hash;
+  std::string payload_hash;
+
+  if (!request->size) {
+    payload_hash = k_empty_payload_hash;
+  } else if (m_unsigned_payload) {
+    payload_hash = k_unsigned_payload;
+  } else if (!request->body_sha256.empty()) {
+    payload_hash = hex(request->body_sha256);
+  } else {
+    payload_hash = hex_sha256(request->body, request->size);
+  }
 
   // add required headers
   result[k_host_header] = m_host;
@@ -44,7 +44,8 @@ namespace aws {
  * NOTE: this is currently tuned for S3:
  *  - CanonicalURI is URI-encoded once
  *  - CanonicalHeaders include: host, Content-Type (if specified), all x-amz-*.
- *  - Payload is signed.
+ *  - Payload is signed, unless S3_bucket_config::unsigned_payload() is set.
+ *    If request has the payload hash already computed, it is used.
  *
  * Signer also assumes that query string parameters of the URI are listed
  * alphabetically and are already URI-encoded.
@@ -88,6 +89,7 @@ class Aws_signer : public rest::Signer {
   std::string m_region;
   std::string m_service = "s3";
   bool m_sign_all_headers = false;
+  bool m_unsigned_payload = false;
   Aws_credentials_provider *m_credentials_provider;
   std::shared_ptr<Aws_credentials> m_credentials;
   std::vector<unsigned char> m_secret_access_key;
@@ -97,6 +97,10 @@ S3_bucket::S3_bucket(const S3_bucket_config_ptr &config)
       m_object_path_prefix(m_bucket_path +
                            (config->path_style_access() ? "/" : "")) {}
 
+bool S3_bucket::uses_payload_hash() const {
+  return !m_config->unsigned_payload();
+}
+
 rest::Signed_request S3_bucket::list_objects_request(
     const std::string &prefix, size_t limit, bool recursive,
     const Object_details::Fields_mask &, const std::string &start_from) {
@@ -75,6 +75,8 @@ class S3_bucket : public storage::backend::object_storage::Container {
   void delete_objects(const std::vector<std::string> &list);
 
  private:
+  bool uses_payload_hash() const override;
+
   rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
       const Object_details::Fields_mask &fields,
@@ -36,6 +36,7 @@
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "mysqlshdk/libs/aws/aws_signer.h"
 #include "mysqlshdk/libs/aws/config_credentials_provider.h"
@@ -109,6 +110,8 @@ S3_bucket_config::S3_bucket_config(const S3_bucket_options &options)
 
   setup_endpoint_uri();
 
+  setup_payload_signing();
+
   setup_credentials_provider();
 }
 
@@ -274,6 +277,35 @@ void S3_bucket_config::setup_endpoint_uri() {
   }
 }
 
+void S3_bucket_config::setup_payload_signing() {
+  if (!m_profile_from_config_file.has_value()) {
+    return;
+  }
+
+  // s3 = payload_signing_enabled = false, nested settings are stored as
+  // top-level ones
+  const auto &settings = m_profile_from_config_file->settings;
+  const auto setting = settings.find("payload_signing_enabled");
+
+  if (settings.end() == setting ||
+      !shcore::str_caseeq(setting->second, "false")) {
+    return;
+  }
+
+  using storage::utils::get_scheme;
+  using storage::utils::scheme_matches;
+
+  if (!scheme_matches(get_scheme(m_endpoint), "https")) {
+    log_warning(
+        "The 'payload_signing_enabled' setting is ignored, the endpoint '%s' "
+        "does not use HTTPS.",
+        m_endpoint.c_str());
+    return;
+  }
+
+  m_unsigned_payload = true;
+}
+
 void S3_bucket_config::setup_credentials_provider() {
   std::vector<std::unique_ptr<Aws_credentials_provider>> providers;
 
@@ -82,6 +82,12 @@ class S3_bucket_config
 
   const std::string &region() const { return m_region; }
 
+  /**
+   * Whether payload of the requests is not included in the signature
+   * (UNSIGNED-PAYLOAD is used instead of its SHA256 hash).
+   */
+  bool unsigned_payload() const { return m_unsigned_payload; }
+
   Aws_credentials_provider *credentials_provider() const {
     return m_credentials_provider.get();
   }
@@ -107,6 +113,8 @@ class S3_bucket_config
 
   void setup_endpoint_uri();
 
+  void setup_payload_signing();
+
   void setup_credentials_provider();
 
   std::string m_label = "AWS-S3-OS";
@@ -118,6 +126,7 @@ class S3_bucket_config
 
   std::string m_host;
   bool m_path_style_access = false;
+  bool m_unsigned_payload = false;
 
   std::optional<Aws_config_file::Profile> m_profile_from_credentials_file;
   std::optional<Aws_config_file::Profile> m_profile_from_config_file;
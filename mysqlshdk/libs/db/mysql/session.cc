@@ -553,18 +553,7 @@ std::shared_ptr<IResult> Session_impl::run_sql(
   if (_mysql == nullptr) throw std::runtime_error("Not connected");
   mysqlshdk::utils::Profile_timer timer;
   timer.stage_begin("run_sql");
-  if (_prev_result) {
-    _prev_result.reset();
-  } else {
-    MYSQL_RES *unread_result = mysql_use_result(_mysql);
-    mysql_free_result(unread_result);
-  }
-
-  // Discards any pending result
-  while (mysql_next_result(_mysql) == 0) {
-    MYSQL_RES *trailing_result = mysql_use_result(_mysql);
-    mysql_free_result(trailing_result);
-  }
+  discard_pending_results();
 
   DBUG_EXECUTE_IF("sql_test_abort", {
     static int count = std::stoi(getenv("TEST_SQL_UNTIL_CRASH"));
@@ -690,6 +679,103 @@ std::shared_ptr<IResult> Session_impl::run_sql(
   return std::static_pointer_cast<IResult>(result);
 }
 
+void Session_impl::discard_pending_results() {
+  if (_prev_result) {
+    _prev_result.reset();
+  } else {
+    MYSQL_RES *unread_result = mysql_use_result(_mysql);
+    mysql_free_result(unread_result);
+  }
+
+  // Discards any pending result
+  while (mysql_next_result(_mysql) == 0) {
+    MYSQL_RES *trailing_result = mysql_use_result(_mysql);
+    mysql_free_result(trailing_result);
+  }
+}
+
+Batch_result Session_impl::execute_batch(
+    const std::vector<std::string> &statements) {
+  if (_mysql == nullptr) throw std::runtime_error("Not connected");
+
+  Batch_result result;
+
+  if (statements.empty()) return result;
+
+  discard_pending_results();
+
+  std::string sql;
+  {
+    size_t size = 0;
+
+    for (const auto &stmt : statements) {
+      size += stmt.size() + 2;
+    }
+
+    sql.reserve(size);
+  }
+
+  const auto log_sql_handler = shcore::current_log_sql();
+
+  for (const auto &stmt : statements) {
+    log_sql_handler->log(get_thread_id(), stmt);
+    DBUG_LOG("sqlall", get_thread_id() << ": QUERY: " << stmt);
+
+    // new line terminates a possible trailing single-line comment
+    sql.append(stmt).append("\n;");
+  }
+
+  // the last delimiter would produce an empty statement
+  sql.pop_back();
+
+  const auto set_error = [this, &result, &statements]() {
+    result.error = Error(mysql_error(_mysql), mysql_errno(_mysql),
+                         mysql_sqlstate(_mysql));
+
+    shcore::current_log_sql()->log(get_thread_id(),
+                                   statements[result.executed], *result.error);
+    DBUG_LOG("sql", get_thread_id() << ": ERROR: " << result.error->format());
+  };
+
+  if (mysql_set_server_option(_mysql, MYSQL_OPTION_MULTI_STATEMENTS_ON) != 0) {
+    throw Error(mysql_error(_mysql), mysql_errno(_mysql),
+                mysql_sqlstate(_mysql));
+  }
+
+  shcore::on_leave_scope multi_statements_off([this]() {
+    if (_mysql) {
+      mysql_set_server_option(_mysql, MYSQL_OPTION_MULTI_STATEMENTS_OFF);
+    }
+  });
+
+  if (mysql_real_query(_mysql, sql.data(), sql.size()) != 0) {
+    set_error();
+    return result;
+  }
+
+  for (;;) {
+    // statements are not expected to return anything
+    if (MYSQL_RES *unexpected = mysql_store_result(_mysql)) {
+      mysql_free_result(unexpected);
+    }
+
+    const auto info = mysql_info(_mysql);
+    result.info.emplace_back(info ? info : "");
+    ++result.executed;
+
+    const auto rc = mysql_next_result(_mysql);
+
+    if (rc < 0) break;
+
+    if (rc > 0) {
+      set_error();
+      break;
+    }
+  }
+
+  return result;
+}
+
 template <class T>
 static void free_result(T *result) {
   mysql_free_result(result);
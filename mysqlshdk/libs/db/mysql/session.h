@@ -96,6 +96,19 @@ struct Classic_query_attribute : public IQuery_attribute_value {
   int flags = 0;
 };
 
+/**
+ * Outcome of a batch of statements sent in a single multi-statement packet.
+ */
+struct Batch_result {
+  /// number of statements which were executed successfully
+  size_t executed = 0;
+  /// mysql_info() of each statement which was executed successfully
+  std::vector<std::string> info;
+  /// error reported by the statement which failed, no further statements were
+  /// executed by the server
+  std::optional<Error> error;
+};
+
 class Session_impl : public std::enable_shared_from_this<Session_impl> {
   friend class Session;  // The Session class instantiates this class
   friend class Result;   // The Result class uses some functions of this class
@@ -114,6 +127,8 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
 
   inline void execute(const char *sql) { execute(sql, ::strlen(sql)); }
 
+  Batch_result execute_batch(const std::vector<std::string> &statements);
+
   void start_transaction();
   void commit();
   void rollback();
@@ -206,6 +221,8 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
     return _connection_options;
   }
 
+  void discard_pending_results();
+
   std::shared_ptr<IResult> run_sql(
       const char *sql, size_t len, bool lazy_fetch, bool is_udf,
       const std::vector<Query_attribute> &query_attributes = {});
@@ -263,6 +280,18 @@ class SHCORE_PUBLIC Session : public ISession,
     _impl->execute(sql, len);
   }
 
+  /**
+   * Sends all the statements to the server in a single multi-statement packet,
+   * saving a round-trip per statement. Statements are not expected to return
+   * result sets, if they do, these are discarded.
+   *
+   * Execution stops at the first statement which fails.
+   */
+  virtual Batch_result execute_batch(
+      const std::vector<std::string> &statements) {
+    return _impl->execute_batch(statements);
+  }
+
   const char *get_ssl_cipher() const override {
     return _impl->get_ssl_cipher();
   }
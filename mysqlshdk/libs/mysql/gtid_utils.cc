@@ -26,7 +26,13 @@
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <limits>
+#include <map>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/replication.h"
@@ -136,6 +142,263 @@ void iter_ranges(std::string_view gtids, auto &&cb) {
       },
       ",");
 }
+
+/*
+ * Client-side GTID set arithmetic. GTID sets are held as sorted lists of
+ * disjoint, non-adjacent intervals, one list per UUID and tag, so that all the
+ * operations are linear in the number of intervals. Sets which cannot be
+ * strictly parsed (i.e. non-canonical UUIDs) are handled by the server.
+ */
+struct Interval {
+  uint64_t begin;
+  uint64_t end;
+};
+
+using Intervals = std::vector<Interval>;
+
+// UUID and tag (empty if not set), both lowercase -> intervals, untagged
+// intervals of an UUID are ordered first, the same as in the server
+using Interval_map = std::map<std::pair<std::string, std::string>, Intervals>;
+
+// maximum GNO accepted by the server
+constexpr uint64_t k_max_gno = std::numeric_limits<int64_t>::max() - 1;
+
+bool is_canonical_uuid(std::string_view uuid) {
+  if (uuid.size() != 36) return false;
+
+  for (std::size_t i = 0; i < uuid.size(); ++i) {
+    if (8 == i || 13 == i || 18 == i || 23 == i) {
+      if ('-' != uuid[i]) return false;
+    } else if (!std::isxdigit(static_cast<unsigned char>(uuid[i]))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::optional<uint64_t> read_gno(std::string_view gno) {
+  uint64_t value = 0;
+  const auto end = gno.data() + gno.size();
+  const auto result = std::from_chars(gno.data(), end, value);
+
+  if (gno.empty() || result.ec != std::errc{} || result.ptr != end ||
+      0 == value || value > k_max_gno) {
+    return {};
+  }
+
+  return value;
+}
+
+std::optional<Interval> read_interval(std::string_view range) {
+  const auto p = range.find('-');
+  const auto begin = read_gno(range.substr(0, p));
+
+  if (!begin) return {};
+
+  if (std::string_view::npos == p) return Interval{*begin, *begin};
+
+  const auto end = read_gno(range.substr(p + 1));
+
+  if (!end || *end < *begin) return {};
+
+  return Interval{*begin, *end};
+}
+
+void merge_intervals(Intervals *intervals) {
+  if (intervals->empty()) return;
+
+  std::sort(intervals->begin(), intervals->end(),
+            [](const Interval &l, const Interval &r) {
+              return l.begin < r.begin;
+            });
+
+  auto last = intervals->begin();
+
+  for (auto it = std::next(last); it != intervals->end(); ++it) {
+    if (it->begin <= last->end + 1) {
+      last->end = std::max(last->end, it->end);
+    } else {
+      *(++last) = *it;
+    }
+  }
+
+  intervals->erase(std::next(last), intervals->end());
+}
+
+/*
+ * Parses the GTID set, returns nothing if it's not in the form:
+ *   uuid[:tag]:range[:range...][:tag:range[:range...]...][,uuid...]
+ */
+std::optional<Interval_map> parse_gtid_set(std::string_view gtid_set) {
+  Interval_map result;
+  bool valid = true;
+
+  shcore::str_itersplit(
+      gtid_set,
+      [&result, &valid](std::string_view gtids) {
+        gtids = shcore::str_strip_view(gtids);
+
+        if (gtids.empty()) {
+          return true;
+        }
+
+        auto p = gtids.find(':');
+
+        if (std::string_view::npos == p ||
+            !is_canonical_uuid(gtids.substr(0, p))) {
+          valid = false;
+          return false;
+        }
+
+        const auto uuid = shcore::str_lower(gtids.substr(0, p));
+        Intervals *intervals = nullptr;
+
+        shcore::str_itersplit(
+            gtids.substr(p + 1),
+            [&result, &uuid, &intervals, &valid](std::string_view range) {
+              range = shcore::str_strip_view(range);
+
+              if (is_gtid_tag(range)) {
+                // tag needs to be followed by a range
+                if (intervals && intervals->empty()) valid = false;
+
+                intervals = &result[{uuid, shcore::str_lower(range)}];
+              } else if (const auto interval = read_interval(range)) {
+                if (!intervals) intervals = &result[{uuid, {}}];
+
+                intervals->emplace_back(*interval);
+              } else {
+                valid = false;
+              }
+
+              return valid;
+            },
+            ":");
+
+        if (!intervals || intervals->empty()) valid = false;
+
+        return valid;
+      },
+      ",");
+
+  if (!valid) return {};
+
+  for (auto &entry : result) {
+    merge_intervals(&entry.second);
+  }
+
+  return result;
+}
+
+std::string to_string(const Interval_map &gtid_set) {
+  std::string result;
+  const std::string *current_uuid = nullptr;
+
+  for (const auto &[uuid_tag, intervals] : gtid_set) {
+    if (intervals.empty()) continue;
+
+    const auto &[uuid, tag] = uuid_tag;
+
+    if (!current_uuid || *current_uuid != uuid) {
+      if (current_uuid) result.append(",\n");
+
+      result.append(uuid);
+      current_uuid = &uuid;
+    }
+
+    if (!tag.empty()) result.append(":").append(tag);
+
+    for (const auto &interval : intervals) {
+      result.append(":").append(std::to_string(interval.begin));
+
+      if (interval.begin != interval.end) {
+        result.append("-").append(std::to_string(interval.end));
+      }
+    }
+  }
+
+  return result;
+}
+
+Intervals subtract_intervals(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto it = b.begin();
+
+  for (auto current : a) {
+    // skip intervals which end before the current one
+    while (it != b.end() && it->end < current.begin) ++it;
+
+    bool consumed = false;
+
+    for (auto next = it; next != b.end() && next->begin <= current.end;
+         ++next) {
+      if (next->begin > current.begin) {
+        result.emplace_back(Interval{current.begin, next->begin - 1});
+      }
+
+      if (next->end >= current.end) {
+        consumed = true;
+        break;
+      }
+
+      current.begin = next->end + 1;
+    }
+
+    if (!consumed) result.emplace_back(current);
+  }
+
+  return result;
+}
+
+Intervals intersect_intervals(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto l = a.begin();
+  auto r = b.begin();
+
+  while (l != a.end() && r != b.end()) {
+    const auto begin = std::max(l->begin, r->begin);
+    const auto end = std::min(l->end, r->end);
+
+    if (begin <= end) result.emplace_back(Interval{begin, end});
+
+    if (l->end < r->end) {
+      ++l;
+    } else {
+      ++r;
+    }
+  }
+
+  return result;
+}
+
+Interval_map subtract_intervals(Interval_map a, const Interval_map &b) {
+  for (auto &[uuid_tag, intervals] : a) {
+    if (const auto it = b.find(uuid_tag); b.end() != it) {
+      intervals = subtract_intervals(intervals, it->second);
+    }
+  }
+
+  return a;
+}
+
+Interval_map intersect_intervals(const Interval_map &a, const Interval_map &b) {
+  Interval_map result;
+
+  for (const auto &[uuid_tag, intervals] : a) {
+    if (const auto it = b.find(uuid_tag); b.end() != it) {
+      result.emplace(uuid_tag, intersect_intervals(intervals, it->second));
+    }
+  }
+
+  return result;
+}
+
+bool is_empty(const Interval_map &gtid_set) {
+  return std::all_of(gtid_set.begin(), gtid_set.end(), [](const auto &entry) {
+    return entry.second.empty();
+  });
+}
 }  // namespace
 
 Gtid_range::Gtid_range(std::string_view range_uuid, std::string_view range_tag,
@@ -191,8 +454,12 @@ Gtid_set Gtid_set::from_received_transaction_set(
 
 Gtid_set &Gtid_set::normalize(const mysqlshdk::mysql::IInstance &server) {
   if (!std::exchange(m_normalized, true)) {
-    m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, '')",
-                                          m_gtid_set);
+    if (const auto gtid_set = parse_gtid_set(m_gtid_set)) {
+      m_gtid_set = to_string(*gtid_set);
+    } else {
+      m_gtid_set = server.queryf_one_string(
+          0, "", "SELECT gtid_subtract(?, '')", m_gtid_set);
+    }
   }
   return *this;
 }
@@ -205,8 +472,17 @@ Gtid_set &Gtid_set::intersect(const Gtid_set &other,
     return *this;
   }
 
-  // a /\ b = a - (a - b)
   m_normalized = true;
+
+  const auto a = parse_gtid_set(m_gtid_set);
+  const auto b = parse_gtid_set(other.m_gtid_set);
+
+  if (a && b) {
+    m_gtid_set = to_string(intersect_intervals(*a, *b));
+    return *this;
+  }
+
+  // a /\ b = a - (a - b)
   m_gtid_set = server.queryf_one_string(
       0, "", "SELECT gtid_subtract(?, gtid_subtract(?, ?))", other.m_gtid_set,
       other.m_gtid_set, m_gtid_set);
@@ -217,8 +493,17 @@ Gtid_set &Gtid_set::intersect(const Gtid_set &other,
 Gtid_set &Gtid_set::subtract(const Gtid_set &other,
                              const mysqlshdk::mysql::IInstance &server) {
   m_normalized = true;
-  m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)",
-                                        m_gtid_set, other.m_gtid_set);
+
+  const auto a = parse_gtid_set(m_gtid_set);
+  const auto b = parse_gtid_set(other.m_gtid_set);
+
+  if (a && b) {
+    m_gtid_set = to_string(subtract_intervals(*a, *b));
+  } else {
+    m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)",
+                                          m_gtid_set, other.m_gtid_set);
+  }
+
   return *this;
 }
 
@@ -306,6 +591,13 @@ Gtid_set Gtid_set::get_gtids_from(std::string_view uuid,
 
 bool Gtid_set::contains(const Gtid_set &other,
                         const mysqlshdk::mysql::IInstance &server) const {
+  const auto a = parse_gtid_set(m_gtid_set);
+  const auto b = parse_gtid_set(other.m_gtid_set);
+
+  if (a && b) {
+    return is_empty(subtract_intervals(*b, *a));
+  }
+
   return server.queryf_one_int(0, 0, "SELECT gtid_subtract(?, ?) = ''",
                                other.m_gtid_set, m_gtid_set) != 0;
 }
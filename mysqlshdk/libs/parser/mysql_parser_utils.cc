@@ -53,32 +53,38 @@ void prepare_lexer_parser(parsers::MySQLLexer *lexer,
 void check_sql_syntax(const std::string &script,
                       const mysqlshdk::utils::Version &mysql_version,
                       bool ansi_quotes, bool no_backslash_escapes) {
-  antlr4::ANTLRInputStream input;
-  parsers::MySQLLexer lexer(&input);
-  antlr4::CommonTokenStream tokens(&lexer);
-  parsers::MySQLParser parser(&tokens);
+  Sql_syntax_checker{mysql_version, ansi_quotes, no_backslash_escapes}.check(
+      script);
+}
 
+Sql_syntax_checker::Sql_syntax_checker(
+    const mysqlshdk::utils::Version &mysql_version, bool ansi_quotes,
+    bool no_backslash_escapes)
+    : m_ansi_quotes(ansi_quotes),
+      m_no_backslash_escapes(no_backslash_escapes),
+      m_lexer(&m_input),
+      m_tokens(&m_lexer),
+      m_parser(&m_tokens),
+      m_bail_strategy(std::make_shared<antlr4::BailErrorStrategy>()),
+      m_default_strategy(std::make_shared<antlr4::DefaultErrorStrategy>()) {
   // TODO(alfredo) stop forcing ansi_quotes when parser fixed
-  prepare_lexer_parser(&lexer, &parser, mysql_version, ansi_quotes || true,
+  prepare_lexer_parser(&m_lexer, &m_parser, mysql_version, ansi_quotes || true,
                        no_backslash_escapes);
 
+  // errors are reported via exceptions, don't print them to the console
+  m_lexer.removeErrorListeners();
+  m_lexer.addErrorListener(&m_error_listener);
+  m_parser.removeErrorListeners();
+  m_parser.addErrorListener(&m_error_listener);
+}
+
+void Sql_syntax_checker::check(const std::string &script) {
   std::stringstream stream(script);
   mysqlshdk::utils::iterate_sql_stream(
       &stream, 4098,
-      [&](std::string_view stmt, std::string_view /*delim*/, size_t /*lnum*/,
-          size_t /* offs */) {
-        internal::ParserErrorListener error_listener;
-        parser.reset();
-        lexer.reset();
-        lexer.addErrorListener(&error_listener);
-        parser.addErrorListener(&error_listener);
-        input.load(std::string(stmt));
-        lexer.setInputStream(&input);
-        tokens.setTokenSource(&lexer);
-        parser.setTokenStream(&tokens);
-
-        parser.query();
-
+      [this](std::string_view stmt, std::string_view /*delim*/,
+             size_t /*lnum*/, size_t /* offs */) {
+        check_statement(stmt);
         return true;
       },
       [](std::string_view msg) {
@@ -86,7 +92,43 @@ void check_sql_syntax(const std::string &script,
             shcore::str_format("Error splitting SQL: %.*s",
                                static_cast<int>(msg.size()), msg.data()));
       },
-      ansi_quotes, no_backslash_escapes);
+      m_ansi_quotes, m_no_backslash_escapes);
+}
+
+void Sql_syntax_checker::check_statement(std::string_view stmt) {
+  m_parser.reset();
+  m_lexer.reset();
+  m_input.load(std::string(stmt));
+  m_lexer.setInputStream(&m_input);
+  m_tokens.setTokenSource(&m_lexer);
+  m_parser.setTokenStream(&m_tokens);
+
+  const auto simulator =
+      m_parser.getInterpreter<antlr4::atn::ParserATNSimulator>();
+
+  // first try the SLL mode, for most of statements it's enough and it's
+  // significantly faster
+  simulator->setPredictionMode(antlr4::atn::PredictionMode::SLL);
+  m_parser.setErrorHandler(m_bail_strategy);
+
+  try {
+    m_parser.query();
+    return;
+  } catch (const antlr4::ParseCancellationException &) {
+    // SLL failed, this is either a syntax error, or a statement which needs
+    // the full context to be parsed
+  }
+
+  ++m_ll_fallbacks;
+
+  // tokens are already there, rewind the stream and parse again
+  m_tokens.seek(0);
+  m_parser.reset();
+
+  simulator->setPredictionMode(antlr4::atn::PredictionMode::LL);
+  m_parser.setErrorHandler(m_default_strategy);
+
+  m_parser.query();
 }
 
 }  // namespace parser
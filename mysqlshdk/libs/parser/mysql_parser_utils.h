@@ -26,9 +26,11 @@
 #ifndef MYSQLSHDK_LIBS_PARSER_MYSQL_PARSER_UTILS_H_
 #define MYSQLSHDK_LIBS_PARSER_MYSQL_PARSER_UTILS_H_
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -256,6 +258,62 @@ void check_sql_syntax(const std::string &script,
                       bool ansi_quotes = false,
                       bool no_backslash_escapes = false);
 
+/**
+ * Checks syntax of SQL scripts, the lexer and parser are created once and
+ * reused for all the checked statements.
+ *
+ * Each statement is first parsed using the faster SLL prediction mode, which
+ * bails out on the first error. Only if that fails, statement is parsed again
+ * using the full LL prediction, which reports the actual syntax error.
+ *
+ * This class is not thread-safe, each thread should use its own instance.
+ */
+class Sql_syntax_checker final {
+ public:
+  explicit Sql_syntax_checker(
+      const mysqlshdk::utils::Version &mysql_version = {},
+      bool ansi_quotes = false, bool no_backslash_escapes = false);
+
+  Sql_syntax_checker(const Sql_syntax_checker &) = delete;
+  Sql_syntax_checker(Sql_syntax_checker &&) = delete;
+
+  Sql_syntax_checker &operator=(const Sql_syntax_checker &) = delete;
+  Sql_syntax_checker &operator=(Sql_syntax_checker &&) = delete;
+
+  ~Sql_syntax_checker() = default;
+
+  /**
+   * Checks syntax of all statements in the given script.
+   *
+   * @param script SQL script, may contain DELIMITER commands.
+   *
+   * @throws Sql_syntax_error if any of the statements is not valid
+   */
+  void check(const std::string &script);
+
+  /**
+   * Number of statements which had to be parsed using the LL prediction mode.
+   */
+  inline std::size_t ll_fallbacks() const noexcept { return m_ll_fallbacks; }
+
+ private:
+  void check_statement(std::string_view stmt);
+
+  bool m_ansi_quotes;
+  bool m_no_backslash_escapes;
+
+  antlr4::ANTLRInputStream m_input;
+  parsers::MySQLLexer m_lexer;
+  antlr4::CommonTokenStream m_tokens;
+  parsers::MySQLParser m_parser;
+
+  internal::ParserErrorListener m_error_listener;
+  std::shared_ptr<antlr4::BailErrorStrategy> m_bail_strategy;
+  std::shared_ptr<antlr4::DefaultErrorStrategy> m_default_strategy;
+
+  std::size_t m_ll_fallbacks = 0;
+};
+
 }  // namespace parser
 }  // namespace mysqlshdk
 
@@ -26,6 +26,10 @@
 #include "mysqlshdk/libs/rest/rest_service.h"
 
 #include <curl/curl.h>
+#include <atomic>
+#include <cinttypes>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -144,6 +148,101 @@ static CURLcode sslctx_function(CURL *curl, void *sslctx, void *parm) {
 
 #endif  // _WIN32
 
+std::mutex g_options_mutex;
+Transport_options g_options;
+
+std::atomic<uint64_t> g_requests{0};
+std::atomic<uint64_t> g_connections{0};
+
+/**
+ * Process-wide CURL share handle, shares DNS cache, TLS sessions and the
+ * connection pool between all the REST services.
+ *
+ * Each service holds a reference to the share, so it's cleaned up only after
+ * all the easy handles which use it are gone. The global reference is dropped
+ * by release_transport(), before libcurl is deinitialized.
+ */
+class Curl_share final {
+ public:
+  Curl_share(const Curl_share &) = delete;
+  Curl_share(Curl_share &&) = delete;
+
+  Curl_share &operator=(const Curl_share &) = delete;
+  Curl_share &operator=(Curl_share &&) = delete;
+
+  ~Curl_share() {
+    if (m_handle) curl_share_cleanup(m_handle);
+  }
+
+  static std::shared_ptr<Curl_share> get() {
+    auto &global = instance();
+    std::lock_guard lock{global.mutex};
+
+    if (!global.share) {
+      global.share.reset(new Curl_share());
+    }
+
+    return global.share;
+  }
+
+  static void release() {
+    auto &global = instance();
+    std::lock_guard lock{global.mutex};
+
+    global.share.reset();
+  }
+
+  CURLSH *handle() const noexcept { return m_handle; }
+
+ private:
+  struct Global {
+    std::mutex mutex;
+    std::shared_ptr<Curl_share> share;
+  };
+
+  static Global &instance() {
+    static Global s_global;
+    return s_global;
+  }
+
+  Curl_share() : m_handle(curl_share_init()) {
+    if (!m_handle) {
+      log_warning("Failed to initialize the shared REST transport");
+      return;
+    }
+
+    curl_share_setopt(m_handle, CURLSHOPT_LOCKFUNC, &Curl_share::lock);
+    curl_share_setopt(m_handle, CURLSHOPT_UNLOCKFUNC, &Curl_share::unlock);
+    curl_share_setopt(m_handle, CURLSHOPT_USERDATA, this);
+
+    curl_share_setopt(m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+    // sharing of the connection pool was added in libcurl 7.57.0
+    curl_share_setopt(m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+  }
+
+  static void lock(CURL *, curl_lock_data data, curl_lock_access, void *ptr) {
+    static_cast<Curl_share *>(ptr)->m_mutexes[data].lock();
+  }
+
+  static void unlock(CURL *, curl_lock_data data, void *ptr) {
+    static_cast<Curl_share *>(ptr)->m_mutexes[data].unlock();
+  }
+
+  CURLSH *m_handle;
+  std::mutex m_mutexes[CURL_LOCK_DATA_LAST];
+};
+
+void on_request(CURL *handle) {
+  long connections = 0;
+  curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &connections);
+
+  ++g_requests;
+  g_connections += connections;
+}
+
 std::string format_headers(const Headers &headers) {
   std::string result;
 
@@ -208,6 +307,51 @@ std::string type_name(Type method) {
   throw std::logic_error("Unknown method received");
 }
 
+double Transport_stats::reuse_rate() const {
+  if (0 == requests || connections >= requests) {
+    return 0.0;
+  }
+
+  return 1.0 - static_cast<double>(connections) / requests;
+}
+
+std::string Transport_stats::to_string() const {
+  return shcore::str_format("%" PRIu64 " requests, %" PRIu64
+                            " new connections, %.1f%% of connections reused",
+                            requests, connections, 100.0 * reuse_rate());
+}
+
+Transport_stats Transport_stats::operator-(
+    const Transport_stats &start) const {
+  Transport_stats stats;
+
+  stats.requests = requests - start.requests;
+  stats.connections = connections - start.connections;
+
+  return stats;
+}
+
+void set_transport_options(const Transport_options &options) {
+  std::lock_guard lock{g_options_mutex};
+  g_options = options;
+}
+
+Transport_options transport_options() {
+  std::lock_guard lock{g_options_mutex};
+  return g_options;
+}
+
+Transport_stats transport_stats() {
+  Transport_stats stats;
+
+  stats.requests = g_requests;
+  stats.connections = g_connections;
+
+  return stats;
+}
+
+void release_transport() { Curl_share::release(); }
+
 class Rest_service::Impl {
  public:
   /**
@@ -238,6 +382,8 @@ class Rest_service::Impl {
     curl_easy_setopt(m_handle.get(), CURLOPT_TCP_KEEPALIVE, 1L);
 #endif
 
+    set_transport(Curl_share::get());
+
     // error buffer, once set, must be available until curl_easy_cleanup() is
     // called
     curl_easy_setopt(m_handle.get(), CURLOPT_ERRORBUFFER, m_error_buffer);
@@ -331,8 +477,20 @@ class Rest_service::Impl {
     curl_easy_setopt(m_handle.get(), CURLOPT_WRITEDATA,
                      response ? response->body : nullptr);
 
+    if (m_fresh_connect) {
+      curl_easy_setopt(m_handle.get(), CURLOPT_FRESH_CONNECT, 1L);
+    }
+
     // execute the request
     auto ret_val = curl_easy_perform(m_handle.get());
+
+    if (m_fresh_connect) {
+      curl_easy_setopt(m_handle.get(), CURLOPT_FRESH_CONNECT, 0L);
+      m_fresh_connect = false;
+    }
+
+    on_request(m_handle.get());
+
     if (ret_val != CURLE_OK) {
       log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), m_request_sequence,
                 m_error_buffer, ret_val);
@@ -388,10 +546,40 @@ class Rest_service::Impl {
   const Masked_string &base_url() const { return m_base_url; }
 
   void reset_connection() {
+    // detach from the share before duplicating the handle, the new one is
+    // attached again
+    curl_easy_setopt(m_handle.get(), CURLOPT_SHARE, nullptr);
     m_handle.reset(curl_easy_duphandle(m_handle.get()));
+    set_transport(Curl_share::get());
+    // connection pool is shared, the connection used by the failed request
+    // may be still there, make sure the next one uses a new connection
+    m_fresh_connect = true;
   }
 
  private:
+  void set_transport(std::shared_ptr<Curl_share> share) {
+    m_share = std::move(share);
+
+    curl_easy_setopt(m_handle.get(), CURLOPT_SHARE, m_share->handle());
+
+    const auto options = transport_options();
+
+    curl_easy_setopt(m_handle.get(), CURLOPT_MAXCONNECTS,
+                     options.max_connections);
+
+    if (options.http2) {
+#ifdef CURL_HTTP_VERSION_2TLS
+      curl_easy_setopt(m_handle.get(), CURLOPT_HTTP_VERSION,
+                       CURL_HTTP_VERSION_2TLS);
+      // wait for a connection which can be multiplexed, instead of opening a
+      // new one
+      curl_easy_setopt(m_handle.get(), CURLOPT_PIPEWAIT, 1L);
+#else
+      log_warning("HTTP/2 is not supported by libcurl");
+#endif
+    }
+  }
+
   void verify_ssl(bool verify) {
     curl_easy_setopt(m_handle.get(), CURLOPT_SSL_VERIFYHOST, verify ? 2L : 0L);
     curl_easy_setopt(m_handle.get(), CURLOPT_SSL_VERIFYPEER, verify ? 1L : 0L);
@@ -500,6 +688,9 @@ class Rest_service::Impl {
     return static_cast<Response::Status_code>(response_code);
   }
 
+  // easy handle has to be cleaned up before the share it's attached to
+  std::shared_ptr<Curl_share> m_share;
+
   std::unique_ptr<CURL, void (*)(CURL *)> m_handle;
 
   char m_error_buffer[CURL_ERROR_SIZE];
@@ -515,6 +706,8 @@ class Rest_service::Impl {
   int m_request_sequence;
 
   long m_default_timeout;
+
+  bool m_fresh_connect = false;
 };
 
 Rest_service::Rest_service(const Masked_string &base_url, bool verify_ssl,
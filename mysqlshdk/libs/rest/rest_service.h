@@ -26,6 +26,7 @@
 #ifndef MYSQLSHDK_LIBS_REST_REST_SERVICE_H_
 #define MYSQLSHDK_LIBS_REST_REST_SERVICE_H_
 
+#include <cstdint>
 #include <future>
 #include <memory>
 #include <string>
@@ -43,10 +44,84 @@ namespace rest {
 
 std::string type_name(Type t);
 
+/**
+ * Options of the transport shared by all REST services.
+ */
+struct Transport_options {
+  /**
+   * Maximum number of idle connections which are kept alive.
+   */
+  long max_connections = 8;
+
+  /**
+   * Negotiate HTTP/2 when connecting over TLS, falls back to HTTP/1.1 if
+   * server does not support it.
+   */
+  bool http2 = false;
+};
+
+/**
+ * Sets the options of the shared transport, used by the services created
+ * afterwards.
+ *
+ * @param options Transport options.
+ */
+void set_transport_options(const Transport_options &options);
+
+/**
+ * Provides the current options of the shared transport.
+ */
+Transport_options transport_options();
+
+/**
+ * Statistics of the transport shared by all REST services.
+ */
+struct Transport_stats {
+  /**
+   * Number of executed requests (including the retried ones).
+   */
+  uint64_t requests = 0;
+
+  /**
+   * Number of new connections (and thus handshakes) made.
+   */
+  uint64_t connections = 0;
+
+  /**
+   * Fraction of the requests which were sent using an existing connection.
+   */
+  double reuse_rate() const;
+
+  std::string to_string() const;
+
+  /**
+   * Statistics collected between the two snapshots.
+   */
+  Transport_stats operator-(const Transport_stats &start) const;
+};
+
+/**
+ * Provides the statistics of the shared transport, collected since the start
+ * of the process. Take a snapshot when an operation starts and subtract it to
+ * get the statistics of that operation.
+ */
+Transport_stats transport_stats();
+
+/**
+ * Releases the global reference to the shared transport, it's cleaned up once
+ * all existing services are destroyed. Services created afterwards use a new
+ * one. Needs to be called before libcurl is deinitialized.
+ */
+void release_transport();
+
 /**
  * A REST service. By default, requests will follow redirections and
  * keep the connections alive.
  *
+ * All services share the DNS cache, TLS sessions and the pool of open
+ * connections, so a connection established by one service (i.e. in a
+ * different thread) can be reused by another one, connecting to the same host.
+ *
  * This is a move-only type.
  */
 class Rest_service {
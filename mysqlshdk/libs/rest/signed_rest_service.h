@@ -30,6 +30,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/rest/response.h"
 #include "mysqlshdk/libs/rest/rest_service.h"
@@ -50,6 +51,12 @@ struct Signed_request : public rest::Request {
 
   const Headers &unsigned_headers() const { return m_headers; }
 
+  /**
+   * SHA256 hash of the body, if it was computed by the caller. Signers which
+   * need it will compute it, if it's not set.
+   */
+  std::vector<unsigned char> body_sha256;
+
  private:
   friend class Signed_rest_service;
 
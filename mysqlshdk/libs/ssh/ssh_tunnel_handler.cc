@@ -42,6 +42,26 @@ namespace mysqlshdk {
 namespace ssh {
 
 namespace {
+// maximum number of buffers transferred in one direction of a connection,
+// before other connections are handled
+constexpr int k_max_buffers_per_transfer = 16;
+
+// time to wait for the client socket to become writable
+constexpr int k_send_wait_ms = 100;
+
+void wait_until_writable(int sock) {
+  pollfd p;
+  p.fd = sock;
+  p.events = POLLOUT;
+  p.revents = 0;
+
+#ifdef _WIN32
+  WSAPoll(&p, 1, k_send_wait_ms);
+#else
+  poll(&p, 1, k_send_wait_ms);
+#endif
+}
+
 int on_socket_event(socket_t UNUSED(fd), int UNUSED(revents),
                     void *UNUSED(userdata)) {
   // the return should be:
@@ -66,6 +86,7 @@ Ssh_tunnel_handler::Ssh_tunnel_handler(uint16_t local_port, int local_socket,
     : m_session(std::move(session)),
       m_local_port(local_port),
       m_local_socket(local_socket) {
+  m_buffer.resize(m_session->config().get_buffer_size());
   make_event();
 }
 
@@ -107,6 +128,8 @@ void Ssh_tunnel_handler::run() { handle_connection(); }
 void Ssh_tunnel_handler::handle_connection() {
   log_debug3("SSH: tunnel handler: Start tunnel handler thread.");
   int rc = 0;
+  // if some data was not transferred, don't wait for new events
+  bool pending = false;
 
   do {
     std::unique_lock<std::recursive_mutex> lock(m_new_connection_mtx);
@@ -115,7 +138,8 @@ void Ssh_tunnel_handler::handle_connection() {
       m_new_connection.pop();
     }
     lock.unlock();
-    rc = ssh_event_dopoll(m_event, 100);
+    rc = ssh_event_dopoll(m_event, pending ? 0 : 100);
+    pending = false;
 
     if (rc == SSH_ERROR) {
       auto ssh_error = m_session->get_ssh_error();
@@ -149,8 +173,8 @@ void Ssh_tunnel_handler::handle_connection() {
     for (auto it = m_client_socket_list.begin();
          it != m_client_socket_list.end() && !m_stop;) {
       try {
-        transfer_data_from_client(it->first, it->second.get());
-        transfer_data_to_client(it->first, it->second.get());
+        pending |= transfer_data_from_client(it->first, it->second.get());
+        pending |= transfer_data_to_client(it->first, it->second.get());
         ++it;
       } catch (const Ssh_tunnel_exception &exc) {
         cleanup_socket(m_event, it->first, std::move(it->second));
@@ -199,14 +223,15 @@ bool Ssh_tunnel_handler::handle_new_connection(int incoming_socket) {
   return true;
 }
 
-void Ssh_tunnel_handler::transfer_data_from_client(int sock,
+bool Ssh_tunnel_handler::transfer_data_from_client(int sock,
                                                    ::ssh::Channel *chan) {
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
+  int buffers = 0;
 
-  while (!m_stop && (readlen = recv(sock, buff.data(), buff.size(), 0)) > 0) {
+  while (!m_stop &&
+         (readlen = recv(sock, m_buffer.data(), m_buffer.size(), 0)) > 0) {
     int b_written = 0;
-    for (char *buff_ptr = buff.data(); readlen > 0 && !m_stop;
+    for (char *buff_ptr = m_buffer.data(); readlen > 0 && !m_stop;
          buff_ptr += b_written, readlen -= b_written) {
       try {
         b_written = chan->write(buff_ptr, readlen);
@@ -218,7 +243,11 @@ void Ssh_tunnel_handler::transfer_data_from_client(int sock,
         throw Ssh_tunnel_exception(exc.getError());
       }
     }
+
+    if (++buffers >= k_max_buffers_per_transfer) return true;
   }
+
+  return false;
 }
 
 namespace {
@@ -239,13 +268,14 @@ std::string err_code_to_string(int err) {
 }
 }  // namespace
 
-void Ssh_tunnel_handler::transfer_data_to_client(int sock,
+bool Ssh_tunnel_handler::transfer_data_to_client(int sock,
                                                  ::ssh::Channel *chan) {
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
+  int buffers = 0;
+
   do {
     try {
-      readlen = chan->readNonblocking(buff.data(), buff.size());
+      readlen = chan->readNonblocking(m_buffer.data(), m_buffer.size());
     } catch (::ssh::SshException &exc) {
       throw Ssh_tunnel_exception(exc.getError());
     }
@@ -263,11 +293,12 @@ void Ssh_tunnel_handler::transfer_data_to_client(int sock,
     }
 
     ssize_t b_written = 0;
-    for (char *buff_ptr = buff.data(); readlen > 0 && !m_stop;
+    for (char *buff_ptr = m_buffer.data(); readlen > 0 && !m_stop;
          buff_ptr += b_written, readlen -= b_written) {
       do {
         b_written = send(sock, buff_ptr, readlen, MSG_NOSIGNAL);
         if (b_written <= 0 && (errno == EAGAIN || errno == EINTR)) {
+          if (errno == EAGAIN) wait_until_writable(sock);
           continue;
         } else {
           break;
@@ -278,7 +309,11 @@ void Ssh_tunnel_handler::transfer_data_to_client(int sock,
         throw Ssh_tunnel_exception("unable to write, client disconnected");
       }
     }
+
+    if (++buffers >= k_max_buffers_per_transfer) return true;
   } while (!m_stop);
+
+  return false;
 }
 
 std::unique_ptr<::ssh::Channel> Ssh_tunnel_handler::open_tunnel() {
@@ -37,6 +37,7 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 #include "mysqlshdk/libs/ssh/ssh_common.h"
 #include "mysqlshdk/libs/ssh/ssh_session.h"
 
@@ -85,8 +86,17 @@ class Ssh_tunnel_handler : public Ssh_thread {
 
  private:
   void handle_connection();
-  void transfer_data_from_client(int sock, ::ssh::Channel *chan);
-  void transfer_data_to_client(int sock, ::ssh::Channel *chan);
+
+  /**
+   * Transfers the data between client socket and the channel. At most a
+   * limited number of buffers is transferred, so that a single busy
+   * connection does not starve the other ones.
+   *
+   * @returns true if there may be more data to transfer
+   */
+  bool transfer_data_from_client(int sock, ::ssh::Channel *chan);
+  bool transfer_data_to_client(int sock, ::ssh::Channel *chan);
+
   std::unique_ptr<::ssh::Channel> open_tunnel();
   void prepare_tunnel(int client_socket);
   void make_event();
@@ -95,6 +105,8 @@ class Ssh_tunnel_handler : public Ssh_thread {
   std::recursive_mutex m_new_connection_mtx;
   std::queue<int> m_new_connection;
   std::atomic_int m_usage = 0;
+  // shared by all connections, data is transferred by a single thread
+  std::vector<char> m_buffer;
 };
 
 }  // namespace ssh
@@ -85,9 +85,13 @@ std::unordered_set<IDirectory::File_info> Directory::filter_files(
           (entry.path().filename().native());
 
       if (pattern.empty() || shcore::match_glob(pattern, name)) {
-        files.emplace(std::move(name), [entry = std::move(entry)]() {
-          return entry.file_size();
+        IDirectory::File_info info{std::move(name),
+                                   [entry]() { return entry.file_size(); }};
+        info.set_version([entry = std::move(entry)]() {
+          return std::to_string(
+              entry.last_write_time().time_since_epoch().count());
         });
+        files.emplace(std::move(info));
       }
     }
   }
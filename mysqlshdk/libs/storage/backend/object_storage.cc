@@ -66,19 +66,20 @@ std::unordered_set<IDirectory::File_info> Directory::list_files(
   std::vector<Object_details> objects;
 
   try {
-    objects = m_container->list_objects(m_prefix, 0, false);
+    objects = m_container->list_objects(
+        m_prefix, 0, false,
+        Object_details::NAME_SIZE | Object_details::Fields::ETAG);
   } catch (const rest::Response_error &error) {
     throw rest::to_exception(error);
   }
 
-  if (m_prefix.empty()) {
-    for (auto &object : objects) {
-      files.emplace(std::move(object.name), object.size);
-    }
-  } else {
-    for (const auto &object : objects) {
-      files.emplace(object.name.substr(m_prefix.size()), object.size);
-    }
+  for (auto &object : objects) {
+    IDirectory::File_info info{
+        m_prefix.empty() ? std::move(object.name)
+                         : object.name.substr(m_prefix.size()),
+        object.size};
+    info.set_version(std::move(object.etag));
+    files.emplace(std::move(info));
   }
 
   if (hidden_files) {
@@ -322,6 +323,10 @@ void Object::remove() { m_container->delete_object(full_path().real()); }
 
 Object::Writer::Writer(Object *owner, Multipart_object *object)
     : File_handler(owner), m_is_multipart(false) {
+  if (m_object->m_container->uses_payload_hash()) {
+    m_part_hash.emplace();
+  }
+
   // This is the writer for an already started multipart object
   if (object) {
     m_multipart = *object;
@@ -379,18 +384,21 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
       // BUFFERED DATA: fills the buffer and sends it
       const auto buffer_space = MY_MAX_PART_SIZE - m_buffer.size();
       m_buffer.append(incoming + incoming_offset, buffer_space);
+      update_part_hash(incoming + incoming_offset, buffer_space);
 
       part = m_buffer.data();
       incoming_offset += buffer_space;
     } else {
       // NO BUFFERED DATA: sends the data directly from the incoming buffer
       part = incoming + incoming_offset;
+      update_part_hash(part, MY_MAX_PART_SIZE);
       incoming_offset += MY_MAX_PART_SIZE;
     }
 
     try {
       m_parts.push_back(m_object->m_container->upload_part(
-          m_multipart, m_parts.size() + 1, part, MY_MAX_PART_SIZE));
+          m_multipart, m_parts.size() + 1, part, MY_MAX_PART_SIZE,
+          part_hash()));
     } catch (const rest::Response_error &error) {
       abort_multipart_upload("failure uploading part", error.format());
       throw rest::to_exception(error);
@@ -402,8 +410,10 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
 
   // REMAINING DATA: gets buffered again
   const auto remaining_input = length - incoming_offset;
-  if (remaining_input)
+  if (remaining_input) {
     m_buffer.append(incoming + incoming_offset, remaining_input);
+    update_part_hash(incoming + incoming_offset, remaining_input);
+  }
 
   m_size += length;
 
@@ -416,7 +426,8 @@ void Object::Writer::close() {
     try {
       if (!m_buffer.empty()) {
         m_parts.push_back(m_object->m_container->upload_part(
-            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size()));
+            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size(),
+            part_hash()));
       }
 
       m_object->m_container->commit_multipart_upload(m_multipart, m_parts);
@@ -432,7 +443,8 @@ void Object::Writer::close() {
     try {
       if (!m_buffer.empty()) {
         m_object->m_container->put_object(m_object->full_path().real(),
-                                          m_buffer.data(), m_buffer.size());
+                                          m_buffer.data(), m_buffer.size(),
+                                          part_hash());
       }
     } catch (const rest::Response_error &error) {
       throw rest::to_exception(error);
@@ -449,6 +461,20 @@ void Object::Writer::reset() {
   m_is_multipart = false;
   m_buffer.clear();
   m_parts.clear();
+
+  if (m_part_hash) {
+    m_part_hash.emplace();
+  }
+}
+
+void Object::Writer::update_part_hash(const char *data, size_t length) {
+  if (m_part_hash) {
+    m_part_hash->update(data, length);
+  }
+}
+
+std::vector<unsigned char> Object::Writer::part_hash() {
+  return m_part_hash ? m_part_hash->digest() : std::vector<unsigned char>{};
 }
 
 void Object::Writer::abort_multipart_upload(const char *context,
@@ -29,9 +29,11 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
 
 #include "mysqlshdk/libs/storage/backend/object_storage_bucket.h"
 
@@ -308,7 +310,13 @@ class Object : public mysqlshdk::storage::IFile {
     void abort_multipart_upload(const char *context,
                                 const std::string &error = {});
 
+    void update_part_hash(const char *data, size_t length);
+
+    std::vector<unsigned char> part_hash();
+
     std::string m_buffer;
+    // hash of the data of the current part, updated as data is buffered
+    std::optional<shcore::ssl::Sha256> m_part_hash;
     bool m_is_multipart;
     Multipart_object m_multipart;
     std::vector<Multipart_object_part> m_parts;
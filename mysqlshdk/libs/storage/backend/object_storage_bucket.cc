@@ -153,12 +153,14 @@ void Container::rename_object(const std::string &src_name,
 }
 
 void Container::put_object(const std::string &object_name, const char *data,
-                           size_t size) {
+                           size_t size,
+                           std::vector<unsigned char> data_sha256) {
   Headers headers{{"content-type", "application/octet-stream"}};
 
   auto request = put_object_request(object_name, std::move(headers));
   request.body = data;
   request.size = size;
+  request.body_sha256 = std::move(data_sha256);
 
   try {
     FI_TRIGGER_TRAP(os_bucket,
@@ -332,12 +334,13 @@ Multipart_object Container::create_multipart_upload(
   }
 }
 
-Multipart_object_part Container::upload_part(const Multipart_object &object,
-                                             size_t part_num, const char *body,
-                                             size_t size) {
+Multipart_object_part Container::upload_part(
+    const Multipart_object &object, size_t part_num, const char *body,
+    size_t size, std::vector<unsigned char> body_sha256) {
   auto request = upload_part_request(object, part_num, size);
   request.body = body;
   request.size = size;
+  request.body_sha256 = std::move(body_sha256);
   Response response;
 
   try {
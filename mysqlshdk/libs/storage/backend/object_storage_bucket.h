@@ -123,6 +123,13 @@ class Container {
    */
   virtual bool has_object_rename() const { return true; }
 
+  /**
+   * Determines whether the SHA256 hash of the data which is uploaded is used
+   * when signing the requests. If so, callers can compute it while the data is
+   * being buffered and pass it to put_object() or upload_part().
+   */
+  virtual bool uses_payload_hash() const { return false; }
+
   /**
    * Renames an object.
    *
@@ -137,9 +144,10 @@ class Container {
    * @param object_name: The name of the object to be created.
    * @param data: Buffer containing the information to be stored on the object.
    * @param size: The length of the data contained on the buffer.
+   * @param data_sha256: SHA256 hash of the data, if already computed.
    */
   void put_object(const std::string &object_name, const char *data,
-                  size_t size);
+                  size_t size, std::vector<unsigned char> data_sha256 = {});
 
   /**
    * Retrieves content data from an object.
@@ -215,12 +223,15 @@ class Container {
    * @param object: the multipart object data for which this part belongs.
    * @param part_num: an incremental identifier for the part, the object will be
    * assembled joining the parts in ascending order based on this identifier.
+   * @param body: the data of the part.
+   * @param size: the size of the data.
+   * @param body_sha256: SHA256 hash of the data, if already computed.
    *
    * @returns the part summary of the uploaded part.
    */
-  Multipart_object_part upload_part(const Multipart_object &object,
-                                    size_t part_num, const char *body,
-                                    size_t size);
+  Multipart_object_part upload_part(
+      const Multipart_object &object, size_t part_num, const char *body,
+      size_t size, std::vector<unsigned char> body_sha256 = {});
 
   /**
    * Finishes a multipart object upload.
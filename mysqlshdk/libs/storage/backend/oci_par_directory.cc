@@ -164,7 +164,7 @@ void Oci_par_directory::create() { /*NOOP*/
 std::string Oci_par_directory::get_list_url() const {
   // use delimiter to limit the number of results, we're just interested in the
   // files in the current directory
-  std::string url = "?fields=name,size&delimiter=/";
+  std::string url = "?fields=name,size,etag&delimiter=/";
 
   if (!m_config->par().object_prefix().empty()) {
     url += "&prefix=" + pctencode_query_value(m_config->par().object_prefix());
@@ -202,8 +202,10 @@ std::unordered_set<IDirectory::File_info> Oci_par_directory::parse_file_list(
     // Such object should be ignored from the listing.
     if (!name.empty() &&
         (pattern.empty() || shcore::match_glob(pattern, name))) {
-      list.emplace(std::move(name),
-                   static_cast<size_t>(file->get_uint("size")));
+      IDirectory::File_info info{std::move(name),
+                                 static_cast<size_t>(file->get_uint("size"))};
+      info.set_version(file->get_string("etag", ""));
+      list.emplace(std::move(info));
     }
   }
 
@@ -35,7 +35,7 @@
 namespace mysqlshdk {
 namespace storage {
 
-enum class Compression { NONE, GZIP, ZSTD };
+enum class Compression { NONE, GZIP, ZSTD, LZ4 };
 
 using Compression_options = std::unordered_map<std::string, std::string>;
 
@@ -103,6 +103,16 @@ std::unique_ptr<IFile> make_file(
     std::unique_ptr<IFile> file, Compression c,
     const Compression_options &compression_options = {});
 
+/**
+ * Wraps a compressed file, so that its data is decompressed by a helper
+ * thread, ahead of the reads.
+ *
+ * @param file File to be read.
+ *
+ * @returns wrapped file, or the given file if it's not compressed
+ */
+std::unique_ptr<IFile> read_ahead(std::unique_ptr<IFile> file);
+
 }  // namespace storage
 }  // namespace mysqlshdk
 
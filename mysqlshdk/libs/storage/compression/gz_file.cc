@@ -89,7 +89,14 @@ ssize_t Gz_file::read(void *buffer, size_t length) {
       consume(consume_bytes);
       update_io(consume_bytes);
     }
-    if (result == Z_STREAM_END || result == Z_BUF_ERROR) {
+    if (result == Z_STREAM_END) {
+      // file may hold multiple concatenated gzip members
+      if (0 == peek(CHUNK).length) {
+        break;
+      }
+
+      inflateReset(&m_stream);
+    } else if (result == Z_BUF_ERROR) {
       break;
     }
   }
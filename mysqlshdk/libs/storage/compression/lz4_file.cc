@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+Lz4_file::Lz4_file(std::unique_ptr<IFile> file,
+                   const Compression_options &options)
+    : Compressed_file(std::move(file)) {
+  parse_compression_options(options, this);
+}
+
+Lz4_file::~Lz4_file() {
+  try {
+    if (is_open()) do_close();
+  } catch (const std::runtime_error &e) {
+    log_error("Failed to close lz4 compressed file: %s", e.what());
+  }
+}
+
+ssize_t Lz4_file::read(void *buffer, size_t length) {
+  const auto out = static_cast<uint8_t *>(buffer);
+  size_t produced = 0;
+
+  start_io();
+
+  while (produced < length) {
+    if (m_buffer_offset == m_buffer_size) {
+      const auto bytes_read = file()->read(m_buffer.data(), m_buffer.size());
+
+      if (bytes_read < 0) {
+        throw std::runtime_error("lz4.read: error reading compressed data");
+      }
+
+      if (0 == bytes_read) {
+        if (m_frame_pending) {
+          throw std::runtime_error("lz4.read: unexpected end of file");
+        }
+
+        break;
+      }
+
+      m_buffer_offset = 0;
+      m_buffer_size = bytes_read;
+    }
+
+    auto out_size = length - produced;
+    auto in_size = m_buffer_size - m_buffer_offset;
+    // once a frame is fully decoded, the context is ready to decompress the
+    // next one, this handles concatenated frames
+    const auto status =
+        LZ4F_decompress(m_dctx, out + produced, &out_size,
+                        m_buffer.data() + m_buffer_offset, &in_size, nullptr);
+
+    if (LZ4F_isError(status)) {
+      throw std::runtime_error(std::string("lz4.read: ") +
+                               LZ4F_getErrorName(status));
+    }
+
+    m_frame_pending = 0 != status;
+    m_buffer_offset += in_size;
+    produced += out_size;
+
+    if (in_size > 0) {
+      update_io(in_size);
+    }
+  }
+
+  finish_io();
+
+  m_offset += produced;
+
+  // number of bytes being returned
+  return produced;
+}
+
+ssize_t Lz4_file::write(const void *buffer, size_t length) {
+  const auto in = static_cast<const uint8_t *>(buffer);
+  size_t consumed = 0;
+
+  start_io();
+
+  while (consumed < length) {
+    const auto chunk = std::min(CHUNK, length - consumed);
+    const auto status =
+        LZ4F_compressUpdate(m_cctx, m_buffer.data(), m_buffer.size(),
+                            in + consumed, chunk, nullptr);
+
+    if (LZ4F_isError(status)) {
+      throw std::runtime_error(std::string("lz4.write: ") +
+                               LZ4F_getErrorName(status));
+    }
+
+    write_compressed(status);
+    consumed += chunk;
+  }
+
+  finish_io();
+
+  m_offset += length;
+
+  return length;
+}
+
+bool Lz4_file::flush() {
+  start_io();
+
+  const auto status =
+      LZ4F_flush(m_cctx, m_buffer.data(), m_buffer.size(), nullptr);
+
+  if (LZ4F_isError(status)) {
+    throw std::runtime_error(std::string("lz4.flush: ") +
+                             LZ4F_getErrorName(status));
+  }
+
+  write_compressed(status);
+
+  finish_io();
+
+  return file()->flush();
+}
+
+void Lz4_file::write_finish() {
+  start_io();
+
+  const auto status =
+      LZ4F_compressEnd(m_cctx, m_buffer.data(), m_buffer.size(), nullptr);
+
+  if (LZ4F_isError(status)) {
+    throw std::runtime_error(std::string("lz4.write: ") +
+                             LZ4F_getErrorName(status));
+  }
+
+  write_compressed(status);
+
+  finish_io();
+}
+
+void Lz4_file::write_compressed(size_t length) {
+  if (0 == length) {
+    return;
+  }
+
+  if (file()->write(m_buffer.data(), length) < 0) {
+    throw std::runtime_error("lz4.write: error writing compressed data");
+  }
+
+  update_io(length);
+}
+
+void Lz4_file::init_write() {
+  if (!m_cctx) {
+    if (LZ4F_isError(
+            LZ4F_createCompressionContext(&m_cctx, LZ4F_getVersion()))) {
+      m_cctx = nullptr;
+      throw std::runtime_error("lz4 compression context init failed");
+    }
+
+    m_preferences = LZ4F_preferences_t{};
+    m_preferences.compressionLevel = m_clevel;
+    // frame holds a checksum of the whole content, like gzip does
+    m_preferences.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+
+    // this is enough to hold the result of every call, including the header
+    m_buffer.resize(std::max<size_t>(LZ4F_compressBound(CHUNK, &m_preferences),
+                                     LZ4F_HEADER_SIZE_MAX));
+
+    start_io();
+
+    const auto status = LZ4F_compressBegin(m_cctx, m_buffer.data(),
+                                           m_buffer.size(), &m_preferences);
+
+    if (LZ4F_isError(status)) {
+      throw std::runtime_error(std::string("lz4.write: ") +
+                               LZ4F_getErrorName(status));
+    }
+
+    write_compressed(status);
+
+    finish_io();
+  }
+}
+
+void Lz4_file::init_read() {
+  if (!m_dctx) {
+    if (LZ4F_isError(
+            LZ4F_createDecompressionContext(&m_dctx, LZ4F_getVersion()))) {
+      m_dctx = nullptr;
+      throw std::runtime_error("lz4 decompression context init failed");
+    }
+
+    m_buffer.resize(READ_CHUNK);
+    m_buffer_offset = 0;
+    m_buffer_size = 0;
+    m_frame_pending = false;
+  }
+}
+
+void Lz4_file::open(Mode m) {
+  if (!file()->is_open()) {
+    file()->open(m);
+  }
+
+  switch (m) {
+    case Mode::READ:
+      init_read();
+      break;
+    case Mode::WRITE:
+      init_write();
+      break;
+    case Mode::APPEND:
+      throw std::invalid_argument("append not supported for lz4 file");
+  }
+
+  m_open_mode = m;
+  m_offset = 0;
+}
+
+bool Lz4_file::is_open() const {
+  return m_open_mode.has_value() && file()->is_open();
+}
+
+void Lz4_file::close() { do_close(); }
+
+void Lz4_file::do_close() {
+  assert(is_open());
+
+  switch (*m_open_mode) {
+    case Mode::READ:
+      if (m_dctx) LZ4F_freeDecompressionContext(m_dctx);
+      m_dctx = nullptr;
+      break;
+
+    case Mode::WRITE:
+      write_finish();
+      if (m_cctx) LZ4F_freeCompressionContext(m_cctx);
+      m_cctx = nullptr;
+      break;
+
+    case Mode::APPEND:
+      break;
+  }
+
+  m_open_mode.reset();
+  m_buffer.resize(0);
+
+  if (file()->is_open()) {
+    file()->close();
+  }
+}
+
+void Lz4_file::parse_compression_options(const Compression_options &options,
+                                         Lz4_file *out) {
+  for (const auto &opt : options) {
+    if (opt.first == "level") {
+      int level;
+      try {
+        level = std::stoi(opt.second);
+      } catch (...) {
+        level = -1;
+      }
+      if (level < 0 || level > LZ4F_compressionLevel_max())
+        throw std::invalid_argument("Invalid compression level for lz4: " +
+                                    opt.second);
+      if (out) out->m_clevel = level;
+    } else {
+      throw std::invalid_argument("Invalid compression option for lz4: " +
+                                  opt.first);
+    }
+  }
+}
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
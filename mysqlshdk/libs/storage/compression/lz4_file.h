@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_COMPRESSION_LZ4_FILE_H_
+#define MYSQLSHDK_LIBS_STORAGE_COMPRESSION_LZ4_FILE_H_
+
+#include <lz4frame.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+/**
+ * Reads and writes files using the LZ4 frame format. Compression is much
+ * faster than gzip and zstd, at the cost of a lower compression ratio, which
+ * makes it suitable for hosts where CPU is the bottleneck.
+ *
+ * Files holding multiple concatenated frames are supported when reading.
+ */
+class Lz4_file : public Compressed_file {
+ public:
+  Lz4_file() = delete;
+
+  explicit Lz4_file(std::unique_ptr<IFile> file,
+                    const Compression_options &options = {});
+
+  Lz4_file(const Lz4_file &other) = delete;
+  Lz4_file(Lz4_file &&other) = default;
+
+  Lz4_file &operator=(const Lz4_file &other) = delete;
+  Lz4_file &operator=(Lz4_file &&other) = default;
+
+  ~Lz4_file() override;
+
+  void open(Mode m) override;
+  bool is_open() const override;
+  void close() override;
+
+  off64_t seek(off64_t) override {
+    throw std::logic_error("Lz4_file::seek() - not supported");
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  bool flush() override;
+
+  ssize_t read(void *buffer, size_t length) override;
+  ssize_t write(const void *buffer, size_t length) override;
+
+  static void parse_compression_options(const Compression_options &options,
+                                        Lz4_file *out);
+
+ private:
+  // size of the uncompressed data passed to a single LZ4F_compressUpdate() call
+  static constexpr const size_t CHUNK = 1 << 16;
+
+  // size of the compressed data read from the underlying file at once
+  static constexpr const size_t READ_CHUNK = 1 << 20;
+
+  void init_read();
+  void init_write();
+  void write_finish();
+
+  void do_close();
+
+  void write_compressed(size_t length);
+
+  size_t m_offset = 0;
+
+  LZ4F_cctx *m_cctx = nullptr;
+  LZ4F_dctx *m_dctx = nullptr;
+  LZ4F_preferences_t m_preferences{};
+  int m_clevel = 1;
+  std::vector<uint8_t> m_buffer;
+  size_t m_buffer_offset = 0;
+  size_t m_buffer_size = 0;
+  // true if the last frame read so far is not complete
+  bool m_frame_pending = false;
+  std::optional<Mode> m_open_mode;
+};
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_COMPRESSION_LZ4_FILE_H_
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/compression/read_ahead_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+Read_ahead_file::Read_ahead_file(std::unique_ptr<IFile> file,
+                                 std::size_t block_size,
+                                 std::size_t max_blocks)
+    : Compressed_file(std::move(file)),
+      m_compressed(dynamic_cast<Compressed_file *>(this->file())),
+      m_block_size(block_size),
+      m_max_blocks(max_blocks) {
+  if (!m_compressed) {
+    throw std::invalid_argument("Read_ahead_file: file is not compressed");
+  }
+
+  if (0 == m_block_size) {
+    throw std::invalid_argument("Read_ahead_file: block size cannot be zero");
+  }
+
+  if (0 == m_max_blocks) {
+    throw std::invalid_argument("Read_ahead_file: need at least one block");
+  }
+}
+
+Read_ahead_file::~Read_ahead_file() {
+  try {
+    stop();
+  } catch (const std::exception &e) {
+    log_error("Failed to stop the read-ahead thread: %s", e.what());
+  }
+}
+
+void Read_ahead_file::open(Mode m) {
+  if (m != Mode::READ) {
+    throw std::invalid_argument("Read_ahead_file: only READ mode is supported");
+  }
+
+  stop();
+
+  Compressed_file::open(m);
+
+  m_current = {};
+  m_consumed = 0;
+  m_offset = 0;
+
+  m_blocks.clear();
+  m_eof = false;
+  m_stop = false;
+  m_exception = nullptr;
+
+  m_thread = mysqlsh::spawn_scoped_thread([this]() { read_ahead(); });
+}
+
+void Read_ahead_file::close() {
+  stop();
+
+  m_current = {};
+  m_blocks.clear();
+
+  Compressed_file::close();
+}
+
+ssize_t Read_ahead_file::read(void *buffer, size_t length) {
+  auto output = static_cast<char *>(buffer);
+  ssize_t result = 0;
+
+  start_io();
+
+  while (length > 0) {
+    if (m_consumed == m_current.data.size() && !next_block()) {
+      break;
+    }
+
+    const auto bytes = std::min(length, m_current.data.size() - m_consumed);
+
+    ::memcpy(output, m_current.data.data() + m_consumed, bytes);
+
+    m_consumed += bytes;
+    result += bytes;
+    output += bytes;
+    length -= bytes;
+  }
+
+  finish_io();
+
+  m_offset += result;
+
+  return result;
+}
+
+void Read_ahead_file::read_ahead() {
+  try {
+    while (true) {
+      Block block;
+      std::size_t bytes = 0;
+
+      block.data.resize(m_block_size);
+
+      while (bytes < m_block_size) {
+        const auto result =
+            file()->read(block.data.data() + bytes, m_block_size - bytes);
+
+        if (result < 0) {
+          throw std::runtime_error("Failed to read '" +
+                                   full_path().masked() + "', error: " +
+                                   std::to_string(file()->error()));
+        }
+
+        block.file_bytes += m_compressed->latest_io_size();
+
+        if (0 == result) {
+          break;
+        }
+
+        bytes += result;
+      }
+
+      block.data.resize(bytes);
+
+      std::unique_lock lock{m_mutex};
+
+      m_block_consumed.wait(lock, [this]() {
+        return m_stop || m_blocks.size() < m_max_blocks;
+      });
+
+      if (m_stop) {
+        return;
+      }
+
+      // a short block means that the end of file was reached, it's still
+      // queued, even if it's empty, so that compressed bytes are reported
+      m_eof = bytes < m_block_size;
+      m_blocks.emplace_back(std::move(block));
+      m_block_ready.notify_one();
+
+      if (m_eof) {
+        return;
+      }
+    }
+  } catch (...) {
+    std::lock_guard lock{m_mutex};
+    m_exception = std::current_exception();
+    m_block_ready.notify_one();
+  }
+}
+
+bool Read_ahead_file::next_block() {
+  std::unique_lock lock{m_mutex};
+
+  m_block_ready.wait(lock, [this]() {
+    return !m_blocks.empty() || m_eof || m_exception;
+  });
+
+  if (m_exception) {
+    std::rethrow_exception(m_exception);
+  }
+
+  if (m_blocks.empty()) {
+    return false;
+  }
+
+  m_current = std::move(m_blocks.front());
+  m_consumed = 0;
+  m_blocks.pop_front();
+  m_block_consumed.notify_one();
+
+  lock.unlock();
+
+  update_io(m_current.file_bytes);
+
+  return true;
+}
+
+void Read_ahead_file::stop() {
+  if (!m_thread.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+  }
+
+  m_block_consumed.notify_one();
+  m_thread.join();
+}
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_COMPRESSION_READ_AHEAD_FILE_H_
+#define MYSQLSHDK_LIBS_STORAGE_COMPRESSION_READ_AHEAD_FILE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+/**
+ * Decompresses data of a compressed file using a helper thread, ahead of the
+ * reads, so that the reader can process the current block of data while the
+ * next one is being decompressed. Only for reading.
+ */
+class Read_ahead_file final : public Compressed_file {
+ public:
+  static constexpr std::size_t k_default_block_size = 1024 * 1024;
+
+  Read_ahead_file() = delete;
+
+  /**
+   * Wraps the compressed file.
+   *
+   * @param file Compressed file.
+   * @param block_size Size of a single block of decompressed data.
+   * @param max_blocks Maximum number of blocks decompressed ahead.
+   *
+   * @throws std::invalid_argument if file is not compressed or configuration
+   *         is not valid
+   */
+  explicit Read_ahead_file(std::unique_ptr<IFile> file,
+                           std::size_t block_size = k_default_block_size,
+                           std::size_t max_blocks = 2);
+
+  Read_ahead_file(const Read_ahead_file &other) = delete;
+  Read_ahead_file(Read_ahead_file &&other) = delete;
+
+  Read_ahead_file &operator=(const Read_ahead_file &other) = delete;
+  Read_ahead_file &operator=(Read_ahead_file &&other) = delete;
+
+  ~Read_ahead_file() override;
+
+  void open(Mode m) override;
+  void close() override;
+
+  off64_t seek(off64_t) override {
+    throw std::logic_error("Read_ahead_file::seek() - not supported");
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override;
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Read_ahead_file::write() - not supported");
+  }
+
+  bool flush() override {
+    throw std::logic_error("Read_ahead_file::flush() - not supported");
+  }
+
+ private:
+  struct Block {
+    std::string data;
+    // number of compressed bytes which were read to produce this block
+    std::size_t file_bytes = 0;
+  };
+
+  void read_ahead();
+
+  bool next_block();
+
+  void stop();
+
+  Compressed_file *m_compressed;
+  std::size_t m_block_size;
+  std::size_t m_max_blocks;
+
+  // block which is being consumed by the reader
+  Block m_current;
+  std::size_t m_consumed = 0;
+  std::size_t m_offset = 0;
+
+  // data shared with the helper thread
+  std::deque<Block> m_blocks;
+  bool m_eof = false;
+  bool m_stop = false;
+  std::exception_ptr m_exception;
+
+  std::mutex m_mutex;
+  std::condition_variable m_block_ready;
+  std::condition_variable m_block_consumed;
+  std::thread m_thread;
+};
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_COMPRESSION_READ_AHEAD_FILE_H_
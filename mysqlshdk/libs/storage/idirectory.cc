@@ -27,6 +27,7 @@
 
 #include <iterator>
 #include <stdexcept>
+#include <utility>
 
 #include "mysqlshdk/libs/storage/backend/directory.h"
 #include "mysqlshdk/libs/storage/utils.h"
@@ -69,6 +70,26 @@ void IDirectory::File_info::set_size(std::size_t s) {
   m_get_size = nullptr;
 }
 
+const std::string &IDirectory::File_info::version() const {
+  if (!m_version.has_value()) {
+    const_cast<File_info *>(this)->set_version(
+        m_get_version ? m_get_version() : std::string{});
+  }
+
+  return m_version.value();
+}
+
+void IDirectory::File_info::set_version(std::string v) {
+  m_version = std::move(v);
+  m_get_version = nullptr;
+}
+
+void IDirectory::File_info::set_version(
+    std::function<std::string()> &&get_version) {
+  m_version.reset();
+  m_get_version = std::move(get_version);
+}
+
 bool IDirectory::File_info::operator<(const File_info &other) const {
   return shcore::natural_compare(name().begin(), name().end(),
                                  other.name().begin(), other.name().end());
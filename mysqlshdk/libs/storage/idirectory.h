@@ -84,6 +84,22 @@ class IDirectory {
      */
     void set_size(std::size_t s);
 
+    /**
+     * Version of the file, a value which changes each time the file is written
+     * (i.e. ETag or modification time). Empty if it's not known.
+     */
+    const std::string &version() const;
+
+    /**
+     * Sets the version.
+     */
+    void set_version(std::string v);
+
+    /**
+     * Version is fetched on first usage.
+     */
+    void set_version(std::function<std::string()> &&get_version);
+
     bool operator<(const File_info &other) const;
 
     bool operator==(const File_info &other) const {
@@ -94,6 +110,8 @@ class IDirectory {
     std::string m_name;
     std::optional<std::size_t> m_size;
     std::function<std::size_t()> m_get_size;
+    std::optional<std::string> m_version;
+    std::function<std::string()> m_get_version;
   };
 
   IDirectory() = default;
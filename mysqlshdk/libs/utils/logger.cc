@@ -39,10 +39,14 @@
 #endif  // !_WIN32
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <ios>
 #include <map>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
@@ -125,10 +129,291 @@ std::string check_logfile_permissions(const std::string &filepath) {
 
 }  // namespace
 
+/**
+ * Implements the asynchronous mode of the Logger.
+ *
+ * Each producer thread owns a single-producer/single-consumer ring buffer,
+ * registered on the first use. Producers only touch their own buffer and a
+ * global sequence counter, the registry mutex is taken only when a thread logs
+ * for the first time. The writer thread periodically drains all the buffers,
+ * sorts the entries by their sequence numbers and writes them out.
+ */
+class Logger::Async_writer final {
+ public:
+  explicit Async_writer(Logger *logger)
+      : m_logger(logger), m_id(++s_next_id) {
+    m_thread = std::thread(&Async_writer::run, this);
+  }
+
+  Async_writer(const Async_writer &) = delete;
+  Async_writer(Async_writer &&) = delete;
+
+  Async_writer &operator=(const Async_writer &) = delete;
+  Async_writer &operator=(Async_writer &&) = delete;
+
+  ~Async_writer() {
+    {
+      std::lock_guard lock{m_wake_mutex};
+      m_stop = true;
+    }
+
+    m_wake.notify_one();
+    m_thread.join();
+
+    std::lock_guard lock{m_rings_mutex};
+
+    for (const auto &ring : m_rings) {
+      ring->writer_gone = true;
+    }
+  }
+
+  void push(const Log_entry &entry) {
+    if (std::this_thread::get_id() == m_thread.get_id()) {
+      // a hook is logging, entry is written in the next cycle, unless there's
+      // no space left, as writer cannot wait for itself
+      if (!try_push(ring(), entry)) m_logger->write_entry(entry);
+      return;
+    }
+
+    auto r = ring();
+
+    while (!try_push(r, entry)) {
+      // buffer is full, wait for the writer to catch up
+      wake();
+      std::this_thread::yield();
+    }
+  }
+
+  void flush() {
+    if (std::this_thread::get_id() == m_thread.get_id()) return;
+
+    std::vector<std::pair<std::shared_ptr<Ring>, uint64_t>> targets;
+
+    {
+      std::lock_guard lock{m_rings_mutex};
+      targets.reserve(m_rings.size());
+
+      for (const auto &ring : m_rings) {
+        targets.emplace_back(ring, ring->tail.load(std::memory_order_acquire));
+      }
+    }
+
+    const auto drained = [&targets]() {
+      return std::all_of(targets.begin(), targets.end(), [](const auto &t) {
+        return t.first->head.load(std::memory_order_acquire) >= t.second;
+      });
+    };
+
+    std::unique_lock lock{m_wake_mutex};
+
+    while (!m_stop) {
+      // entries are removed from the ring before they are written, one full
+      // cycle has to be completed after they were removed
+      const auto done = drained();
+      const auto cycle = m_cycle;
+
+      m_pending = true;
+      m_wake.notify_one();
+      m_cycle_done.wait(lock, [this, cycle]() {
+        return m_stop || m_cycle != cycle;
+      });
+
+      if (done) break;
+    }
+  }
+
+ private:
+  static constexpr std::size_t k_ring_size = 1024;
+  static constexpr auto k_poll_interval = std::chrono::milliseconds(10);
+
+  struct Entry {
+    uint64_t seq = 0;
+    time_t timestamp = 0;
+    LOG_LEVEL level = LOG_NONE;
+    std::string domain;
+    std::string message;
+  };
+
+  struct Ring {
+    // written by the producer
+    alignas(64) std::atomic<uint64_t> tail{0};
+    // written by the writer
+    alignas(64) std::atomic<uint64_t> head{0};
+    std::atomic<bool> thread_gone{false};
+    std::atomic<bool> writer_gone{false};
+    Entry slots[k_ring_size];
+  };
+
+  struct Thread_rings {
+    std::vector<std::pair<uint64_t, std::shared_ptr<Ring>>> rings;
+
+    ~Thread_rings() {
+      for (const auto &r : rings) {
+        r.second->thread_gone = true;
+      }
+    }
+  };
+
+  const std::shared_ptr<Ring> &ring() {
+    thread_local Thread_rings t_rings;
+
+    for (const auto &r : t_rings.rings) {
+      if (r.first == m_id) return r.second;
+    }
+
+    // drop rings of the writers which no longer exist
+    std::erase_if(t_rings.rings,
+                  [](const auto &r) { return r.second->writer_gone.load(); });
+
+    auto ring = std::make_shared<Ring>();
+
+    {
+      std::lock_guard lock{m_rings_mutex};
+      m_rings.emplace_back(ring);
+    }
+
+    return t_rings.rings.emplace_back(m_id, std::move(ring)).second;
+  }
+
+  bool try_push(const std::shared_ptr<Ring> &ring, const Log_entry &entry) {
+    const auto tail = ring->tail.load(std::memory_order_relaxed);
+    const auto used = tail - ring->head.load(std::memory_order_acquire);
+
+    if (used >= k_ring_size) return false;
+
+    auto &slot = ring->slots[tail % k_ring_size];
+
+    slot.seq = m_seq.fetch_add(1, std::memory_order_relaxed);
+    slot.timestamp = entry.timestamp;
+    slot.level = entry.level;
+    // reuses memory allocated by the previous entries
+    slot.domain.assign(entry.domain);
+    slot.message.assign(entry.message);
+
+    ring->tail.store(tail + 1, std::memory_order_release);
+
+    if (used + 1 >= k_ring_size / 2 || entry.level <= LOG_ERROR) wake();
+
+    return true;
+  }
+
+  void wake() {
+    if (!m_pending.exchange(true, std::memory_order_relaxed)) {
+      m_wake.notify_one();
+    }
+  }
+
+  void collect() {
+    std::lock_guard lock{m_rings_mutex};
+
+    for (auto it = m_rings.begin(); it != m_rings.end();) {
+      auto &ring = **it;
+      const auto tail = ring.tail.load(std::memory_order_acquire);
+      auto head = ring.head.load(std::memory_order_relaxed);
+
+      for (; head < tail; ++head) {
+        auto &slot = ring.slots[head % k_ring_size];
+
+        if (m_used == m_batch.size()) m_batch.emplace_back();
+
+        auto &entry = m_batch[m_used++];
+
+        entry.seq = slot.seq;
+        entry.timestamp = slot.timestamp;
+        entry.level = slot.level;
+        // swap, so the slot gets back the memory which was used previously
+        std::swap(entry.domain, slot.domain);
+        std::swap(entry.message, slot.message);
+      }
+
+      ring.head.store(head, std::memory_order_release);
+
+      // thread has finished, and all its entries have been collected, it's
+      // not going to write anything more
+      if (ring.thread_gone &&
+          ring.tail.load(std::memory_order_acquire) == head) {
+        it = m_rings.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  void write() {
+    std::sort(m_batch.begin(), m_batch.begin() + m_used,
+              [](const Entry &l, const Entry &r) { return l.seq < r.seq; });
+
+    for (std::size_t i = 0; i < m_used; ++i) {
+      const auto &entry = m_batch[i];
+      Log_entry log_entry{entry.domain, entry.message, entry.level};
+      log_entry.timestamp = entry.timestamp;
+
+      m_logger->write_entry(log_entry, false);
+    }
+
+    if (m_used) m_logger->flush_file();
+
+    m_used = 0;
+  }
+
+  void run() {
+    bool stop = false;
+
+    while (!stop) {
+      {
+        std::unique_lock lock{m_wake_mutex};
+        m_wake.wait_for(lock, k_poll_interval, [this]() {
+          return m_stop || m_pending.load(std::memory_order_relaxed);
+        });
+        m_pending = false;
+        stop = m_stop;
+      }
+
+      collect();
+      write();
+
+      {
+        std::lock_guard lock{m_wake_mutex};
+        ++m_cycle;
+      }
+
+      m_cycle_done.notify_all();
+    }
+
+    // write out everything that has been logged before the stop request
+    collect();
+    write();
+  }
+
+  static inline std::atomic<uint64_t> s_next_id{0};
+
+  Logger *m_logger;
+  const uint64_t m_id;
+
+  std::atomic<uint64_t> m_seq{0};
+
+  std::mutex m_rings_mutex;
+  std::vector<std::shared_ptr<Ring>> m_rings;
+
+  std::mutex m_wake_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_cycle_done;
+  std::atomic<bool> m_pending{false};
+  bool m_stop = false;
+  uint64_t m_cycle = 0;
+
+  // accessed only by the writer thread
+  std::vector<Entry> m_batch;
+  std::size_t m_used = 0;
+
+  std::thread m_thread;
+};
+
 void Logger::attach_log_hook(Log_hook hook, void *user_data, bool catch_all) {
   if (hook) {
     std::lock_guard l{m_mutex_hooks};
     m_hook_list.emplace_back(hook, user_data, catch_all);
+    update_catch_all_hooks();
   } else {
     throw std::invalid_argument("Logger::attach_log_hook: Null hook pointer");
   }
@@ -140,6 +425,7 @@ void Logger::detach_log_hook(Log_hook hook) {
     m_hook_list.remove_if([hook](const std::tuple<Log_hook, void *, bool> &i) {
       return std::get<0>(i) == hook;
     });
+    update_catch_all_hooks();
   } else {
     throw std::invalid_argument("Logger::detach_log_hook: Null hook pointer");
   }
@@ -168,8 +454,37 @@ void Logger::detach_log_level_hook(Log_level_hook hook) {
   }
 }
 
+void Logger::update_catch_all_hooks() {
+  // called with m_mutex_hooks locked
+  m_has_catch_all_hook = std::any_of(
+      m_hook_list.begin(), m_hook_list.end(),
+      [](const std::tuple<Log_hook, void *, bool> &h) { return std::get<2>(h); });
+}
+
 bool Logger::log_allowed() const { return m_dont_log == 0; }
 
+void Logger::set_async(bool async) {
+  {
+    std::lock_guard lg{g_mutex};
+
+    if (async == m_async) return;
+
+    if (async && !m_async_writer) {
+      m_async_writer = std::make_unique<Async_writer>(this);
+    }
+
+    m_async = async;
+  }
+
+  // threads which have seen the asynchronous mode still enabled may push more
+  // entries, the writer thread keeps running and handles them
+  if (!async) m_async_writer->flush();
+}
+
+void Logger::flush() {
+  if (m_async_writer) m_async_writer->flush();
+}
+
 void Logger::set_log_level(LOG_LEVEL log_level) {
   m_log_level = log_level;
 
@@ -233,42 +548,52 @@ void Logger::do_log(const Log_entry &entry) {
 
 void Logger::do_log(const std::shared_ptr<shcore::Logger> &logger,
                     const Log_entry &entry) {
+  if (logger->m_async) {
+    logger->m_async_writer->push(entry);
+  } else {
+    logger->write_entry(entry);
+  }
+}
+
+void Logger::write_entry(const Log_entry &entry, bool flush_file) {
   std::lock_guard lg{g_mutex};
 
-  if (entry.level <= logger->m_log_level) {
+  if (entry.level <= m_log_level) {
 #ifdef _WIN32
-    if (logger->m_log_file.is_open()) {
+    if (m_log_file.is_open()) {
       const auto s = format_message(entry);
-      logger->m_log_file.write(s.c_str(), s.length());
-      logger->m_log_file.flush();
+      m_log_file.write(s.c_str(), s.length());
+      if (flush_file) m_log_file.flush();
     }
 #else
-    if (logger->m_log_file) {
+    if (m_log_file) {
       const auto s = format_message(entry);
-      fwrite(s.c_str(), s.length(), 1, logger->m_log_file);
-      fflush(logger->m_log_file);
+      fwrite(s.c_str(), s.length(), 1, m_log_file);
+      if (flush_file) fflush(m_log_file);
     }
 #endif
   }
 
-  std::lock_guard lh{logger->m_mutex_hooks};
+  std::lock_guard lh{m_mutex_hooks};
 
-  for (const auto &f : logger->m_hook_list) {
-    if (std::get<2>(f) || entry.level <= logger->m_log_level)
+  for (const auto &f : m_hook_list) {
+    if (std::get<2>(f) || entry.level <= m_log_level)
       std::get<0>(f)(entry, std::get<1>(f));
   }
 }
 
-bool Logger::will_log(LOG_LEVEL level) const {
-  if (level <= m_log_level) return true;
-
-  std::lock_guard l{m_mutex_hooks};
+void Logger::flush_file() {
+  std::lock_guard lg{g_mutex};
 
-  for (const auto &hook : m_hook_list) {
-    if (std::get<2>(hook)) return true;
-  }
+#ifdef _WIN32
+  if (m_log_file.is_open()) m_log_file.flush();
+#else
+  if (m_log_file) fflush(m_log_file);
+#endif
+}
 
-  return false;
+bool Logger::will_log(LOG_LEVEL level) const {
+  return level <= m_log_level || m_has_catch_all_hook;
 }
 
 void Logger::out_to_stderr(const Log_entry &entry, void *) {
@@ -433,6 +758,9 @@ Logger::Logger(const char *filename, bool use_stderr) : m_dont_log(0) {
 }
 
 Logger::~Logger() {
+  // stops the writer thread, all pending entries are written out
+  m_async_writer.reset();
+
 #ifdef _WIN32
   if (m_log_file.is_open()) {
     m_log_file.close();
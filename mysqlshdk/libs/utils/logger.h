@@ -103,6 +103,27 @@ class SHCORE_PUBLIC Logger final {
 
   void stop_log_to_stderr();
 
+  /**
+   * Enables or disables the asynchronous mode.
+   *
+   * In asynchronous mode, callers format their messages into a per-thread,
+   * lock-free ring buffer and return immediately. A background thread drains
+   * these buffers, writes the entries to the log file and invokes the hooks,
+   * preserving the order in which entries were produced. Hooks keep their
+   * semantics, but they are called from the writer thread.
+   *
+   * Disabling the asynchronous mode flushes all the pending entries.
+   */
+  void set_async(bool async);
+
+  bool is_async() const { return m_async; }
+
+  /**
+   * Waits until all entries logged so far are written and passed to the
+   * hooks. Does nothing in synchronous mode.
+   */
+  void flush();
+
 #if __GNUC__ > 2 || (__GNUC__ == 2 && __GNUC_MINOR__ > 4)
   static void log(LOG_LEVEL level, const char *format, ...)
       __attribute__((__format__(__printf__, 2, 3)));
@@ -163,8 +184,16 @@ class SHCORE_PUBLIC Logger final {
   static void do_log(const std::shared_ptr<shcore::Logger> &logger,
                      const Log_entry &entry);
 
+  void write_entry(const Log_entry &entry, bool flush_file = true);
+
+  void flush_file();
+
   bool will_log(LOG_LEVEL level) const;
 
+  void update_catch_all_hooks();
+
+  class Async_writer;
+
   std::atomic<LOG_LEVEL> m_log_level{LOG_NONE};
 
 #ifdef _WIN32
@@ -177,6 +206,10 @@ class SHCORE_PUBLIC Logger final {
   mutable std::mutex m_mutex_hooks;
   std::list<std::tuple<Log_hook, void *, bool>> m_hook_list;
   std::list<std::tuple<Log_level_hook, void *>> m_level_hook_list;
+  std::atomic<bool> m_has_catch_all_hook{false};
+
+  std::atomic<bool> m_async{false};
+  std::unique_ptr<Async_writer> m_async_writer;
 
   mutable std::mutex m_mutex_log_ctx;
   std::list<std::string> m_log_context;
@@ -290,29 +290,50 @@ std::string create_key_pair(const std::string &path,
 }
 
 std::vector<unsigned char> sha256(const char *data, size_t size) {
-  EVP_MD_CTX_ptr mctx(EVP_MD_CTX_new(), ::EVP_MD_CTX_free);
-  const EVP_MD *md = EVP_sha256();
-  int r = EVP_DigestInit_ex(mctx.get(), md, nullptr);
-  if (r != 1) {
-    throw std::runtime_error("SHA256: error initializing encoder.");
+  Sha256 hash;
+  hash.update(data, size);
+  return hash.digest();
+}
+
+struct Sha256::Impl {
+  Impl() { init(); }
+
+  void init() {
+    if (EVP_DigestInit_ex(ctx.get(), EVP_sha256(), nullptr) != 1) {
+      throw std::runtime_error("SHA256: error initializing encoder.");
+    }
   }
 
-  r = EVP_DigestUpdate(mctx.get(), data, size);
-  if (r != 1) {
+  EVP_MD_CTX_ptr ctx{EVP_MD_CTX_new(), ::EVP_MD_CTX_free};
+};
+
+Sha256::Sha256() : m_impl(std::make_unique<Impl>()) {}
+
+Sha256::Sha256(Sha256 &&) noexcept = default;
+
+Sha256 &Sha256::operator=(Sha256 &&) noexcept = default;
+
+Sha256::~Sha256() = default;
+
+void Sha256::update(const char *data, size_t size) {
+  if (EVP_DigestUpdate(m_impl->ctx.get(), data, size) != 1) {
     throw std::runtime_error("SHA256: error while encoding data.");
   }
+}
 
+std::vector<unsigned char> Sha256::digest() {
   std::vector<unsigned char> md_value;
   unsigned int md_len = EVP_MAX_MD_SIZE;
   md_value.resize(md_len);
 
-  r = EVP_DigestFinal_ex(mctx.get(), md_value.data(), &md_len);
-  if (r != 1) {
+  if (EVP_DigestFinal_ex(m_impl->ctx.get(), md_value.data(), &md_len) != 1) {
     throw std::runtime_error("SHA256: error completing encode operation.");
   }
 
   md_value.resize(md_len);
 
+  m_impl->init();
+
   return md_value;
 }
 
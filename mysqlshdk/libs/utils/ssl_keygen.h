@@ -26,6 +26,7 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_SSL_KEYGEN_H_
 #define MYSQLSHDK_LIBS_UTILS_SSL_KEYGEN_H_
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -104,6 +105,38 @@ std::string private_key_fingerprint(const std::string &path);
  */
 std::vector<unsigned char> sha256(const char *data, size_t size);
 
+/**
+ * Computes SHA256 hash of the data which is provided in multiple calls.
+ */
+class Sha256 final {
+ public:
+  Sha256();
+
+  Sha256(const Sha256 &) = delete;
+  Sha256(Sha256 &&) noexcept;
+
+  Sha256 &operator=(const Sha256 &) = delete;
+  Sha256 &operator=(Sha256 &&) noexcept;
+
+  ~Sha256();
+
+  /**
+   * Adds more data to the hash.
+   */
+  void update(const char *data, size_t size);
+
+  /**
+   * Computes hash of all the data provided so far. Resets the state, so that
+   * a new hash can be computed.
+   */
+  std::vector<unsigned char> digest();
+
+ private:
+  struct Impl;
+
+  std::unique_ptr<Impl> m_impl;
+};
+
 std::vector<unsigned char> hmac_sha256(const std::vector<unsigned char> &key,
                                        const std::string &data);
 
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
+#define MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace shcore {
+
+/**
+ * Multiple producer, multiple consumer queue, which holds a separate queue for
+ * each consumer. Producers distribute the items among these queues in a
+ * round-robin fashion, each consumer takes the items from its own queue, and
+ * once it is empty, steals items from the queues of the other consumers.
+ *
+ * Unlike in case of Synchronized_queue, threads contend for a lock only if they
+ * access the same queue at the same time.
+ *
+ * Items with a higher priority are taken first, but, as the queues are not
+ * locked all at once, this is done on a best-effort basis. Guard objects, which
+ * signal consumers to complete operation, are not held in the queues, they are
+ * given out only once all the items are taken.
+ */
+template <class T>
+class Work_stealing_queue final {
+ public:
+  Work_stealing_queue() = delete;
+
+  /**
+   * Creates the queue.
+   *
+   * @param consumers Number of consumer threads.
+   */
+  explicit Work_stealing_queue(std::size_t consumers)
+      : m_queues(std::max(consumers, std::size_t{1})) {}
+
+  Work_stealing_queue(const Work_stealing_queue &other) = delete;
+  Work_stealing_queue(Work_stealing_queue &&other) = delete;
+
+  Work_stealing_queue &operator=(const Work_stealing_queue &other) = delete;
+  Work_stealing_queue &operator=(Work_stealing_queue &&other) = delete;
+
+  ~Work_stealing_queue() = default;
+
+  template <class U = T>
+  void push(U &&r, Queue_priority p = Queue_priority::MEDIUM) {
+    unsynchronized_push(std::forward<U>(r), map_priority(p));
+    notify_one();
+  }
+
+  /**
+   * Takes an item from the queue, waits if there are none.
+   *
+   * @param consumer ID of the consumer, in range [0, consumers).
+   */
+  T pop(std::size_t consumer) {
+    while (true) {
+      if (auto item = try_take(consumer % m_queues.size())) {
+        return std::move(*item);
+      }
+
+      std::unique_lock lock{m_wait_mutex};
+
+      // m_size is incremented before push() returns, so if it's zero, all
+      // items pushed before shutdown() was called have already been taken
+      if (0 == m_size && m_guards > 0) {
+        --m_guards;
+        return T();
+      }
+
+      ++m_waiting;
+      m_item_ready.wait(lock,
+                        [this]() { return 0 != m_size || m_guards > 0; });
+      --m_waiting;
+    }
+  }
+
+  /**
+   * Method that gives n guard objects that signals to consumer threads to
+   * complete operation. Guards are given out once the queue is empty.
+   *
+   * @param n number of consumer threads.
+   */
+  void shutdown(int64_t n) {
+    std::lock_guard lock{m_wait_mutex};
+    m_guards += n;
+    m_item_ready.notify_all();
+  }
+
+  size_t size() const { return m_size + m_guards; }
+
+ private:
+  using Priority_t = std::underlying_type_t<Queue_priority>;
+
+  static constexpr Priority_t map_priority(Queue_priority p) {
+    return static_cast<Priority_t>(p);
+  }
+
+  static constexpr Priority_t k_max_priority =
+      map_priority(Queue_priority::HIGH);
+
+  // each queue is placed in a separate cache line, to avoid false sharing
+  struct alignas(64) Consumer_queue {
+    std::mutex mutex;
+    std::array<std::deque<T>, k_max_priority> items;
+    std::atomic<std::size_t> size{0};
+  };
+
+  // "unsynchronized" means that waiting consumers are not notified
+  template <class U>
+  void unsynchronized_push(U &&u, Priority_t p) {
+    auto &queue = m_queues[m_next_queue++ % m_queues.size()];
+
+    {
+      std::lock_guard lock{queue.mutex};
+      queue.items[k_max_priority - p].emplace_back(std::forward<U>(u));
+      ++queue.size;
+      // incremented while holding the lock, before the item can be taken, so
+      // that it never underflows
+      ++m_size;
+    }
+  }
+
+  void notify_one() {
+    // consumer increments m_waiting before it checks m_size, producer
+    // increments m_size before it checks m_waiting, either producer sees the
+    // waiting consumer, or consumer sees the new item
+    if (0 != m_waiting) {
+      std::lock_guard lock{m_wait_mutex};
+      m_item_ready.notify_one();
+    }
+  }
+
+  std::optional<T> try_take(std::size_t consumer) {
+    const auto count = m_queues.size();
+
+    for (std::size_t idx = 0; idx < k_max_priority; ++idx) {
+      // start with own queue, then try to steal from the others
+      for (std::size_t i = 0; i < count; ++i) {
+        auto &queue = m_queues[(consumer + i) % count];
+
+        if (0 == queue.size) {
+          continue;
+        }
+
+        std::lock_guard lock{queue.mutex};
+        auto &items = queue.items[idx];
+
+        if (!items.empty()) {
+          auto r = std::move(items.front());
+          items.pop_front();
+          --queue.size;
+          --m_size;
+          return r;
+        }
+      }
+    }
+
+    return {};
+  }
+
+  std::vector<Consumer_queue> m_queues;
+  std::atomic<std::size_t> m_next_queue{0};
+  std::atomic<std::size_t> m_size{0};
+
+  std::mutex m_wait_mutex;
+  std::condition_variable m_item_ready;
+  std::atomic<std::size_t> m_waiting{0};
+  // number of guards which were not given out yet, modified while holding
+  // m_wait_mutex
+  std::atomic<int64_t> m_guards{0};
+};
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
@@ -524,7 +524,17 @@ class Provider_sql::Cache final {
   template <class T, is_instance_object<T> = 0>
   static const T *find(const std::vector<T> &container,
                        const std::string &name) {
-    const auto wname = shcore::utf8_to_wide(name);
+    return find(container, shcore::utf8_to_wide(name));
+  }
+
+  template <class T, is_instance_object<T> = 0>
+  static T *find(std::vector<T> *container, const std::wstring &wname) {
+    return const_cast<T *>(find(*container, wname));
+  }
+
+  template <class T, is_instance_object<T> = 0>
+  static const T *find(const std::vector<T> &container,
+                       const std::wstring &wname) {
     const auto range = std::equal_range(container.begin(), container.end(),
                                         wname, Compare_ci{});
 
@@ -648,19 +658,57 @@ class Provider_sql::Cache final {
             "'BASE TABLE' AND TABLE_SCHEMA=" + quote_sql_string(schema->name()),
         target);
 
-    for (auto &table : *target) {
-      fetch_columns(session, schema, &table);
-    }
+    fetch_columns(session, schema, target);
   }
 
   void fetch_columns(const std::shared_ptr<mysqlshdk::db::ISession> &session,
-                     const Instance::Schema *schema, Instance::Table *table) {
-    fetch(session,
-          "SELECT COLUMN_NAME FROM INFORMATION_SCHEMA.COLUMNS WHERE "
-          "TABLE_SCHEMA=" +
-              quote_sql_string(schema->name()) +
-              " AND TABLE_NAME=" + quote_sql_string(table->name()),
-          &table->columns);
+                     const Instance::Schema *schema, Instance::Tables *target) {
+    if (m_cancelled || target->empty()) {
+      return;
+    }
+
+    for (auto &table : *target) {
+      table.columns.clear();
+    }
+
+    // fetch columns of all the tables using a single query, schemas can hold
+    // a lot of tables
+    const auto result = session->query(
+        "SELECT c.TABLE_NAME, c.COLUMN_NAME FROM INFORMATION_SCHEMA.COLUMNS c "
+        "JOIN INFORMATION_SCHEMA.TABLES t ON c.TABLE_SCHEMA=t.TABLE_SCHEMA AND "
+        "c.TABLE_NAME=t.TABLE_NAME WHERE t.TABLE_TYPE" +
+        std::string{target == &schema->tables ? "=" : "<>"} +
+        "'BASE TABLE' AND c.TABLE_SCHEMA=" + quote_sql_string(schema->name()));
+
+    if (result) {
+      Instance::Table *table = nullptr;
+
+      while (!m_cancelled) {
+        const auto row = result->fetch_one();
+
+        if (!row) {
+          break;
+        }
+
+        const auto table_name = row->get_wstring(0);
+
+        if (!table || table->wide_name() != table_name) {
+          table = find(target, table_name);
+        }
+
+        if (table) {
+          table->columns.emplace_back(row->get_wstring(1));
+        }
+      }
+    }
+
+    if (m_cancelled) {
+      return;
+    }
+
+    for (auto &t : *target) {
+      sort(&t.columns);
+    }
   }
 
   void fetch_functions(const std::shared_ptr<mysqlshdk::db::ISession> &session,
@@ -209,6 +209,16 @@ void Shell_cli_operation::parse(Options::Cmdline_iterator *cmdline_iterator) {
   }
 }
 
+std::vector<std::string> Shell_cli_operation::get_cmdline_arguments() const {
+  std::vector<std::string> arguments;
+
+  for (const auto &arg : m_cli_mapper.get_cmdline_args()) {
+    arguments.emplace_back(arg.definition);
+  }
+
+  return arguments;
+}
+
 /**
  * This function is called before the actual execution takes place.
  *
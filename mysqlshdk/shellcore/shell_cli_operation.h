@@ -53,6 +53,13 @@ class Shell_cli_operation {
 
   bool help_requested() { return m_cli_mapper.help_requested(); }
 
+  /**
+   * Provides the arguments given in the command line, as specified by the
+   * user. Once the operation is prepared, the object chain and the operation
+   * name are no longer included.
+   */
+  std::vector<std::string> get_cmdline_arguments() const;
+
   void prepare();
 
   Value execute();
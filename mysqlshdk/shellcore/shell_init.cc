@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <stdexcept>
 
+#include "mysqlshdk/libs/rest/rest_service.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
@@ -68,6 +69,10 @@ void global_init() {
 }
 
 void global_end() {
+  // transport shared by the REST services uses libcurl, release it while the
+  // library is still usable
+  mysqlshdk::rest::release_transport();
+
   thread_end();
   mysql_library_end();
 }
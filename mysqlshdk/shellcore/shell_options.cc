@@ -34,6 +34,7 @@
 #include "modules/mod_utils.h"
 #include "mysqlshdk/libs/db/uri_common.h"
 #include "mysqlshdk/libs/db/uri_parser.h"
+#include "mysqlshdk/libs/rest/rest_service.h"
 #include "mysqlshdk/libs/utils/log_sql.h"
 #include "mysqlshdk/shellcore/credential_manager.h"
 #include "shellcore/ishell_core.h"
@@ -336,6 +337,33 @@ Shell_options::Shell_options(
     "Set buffer size in bytes for data transfer, default is 10240 (10Kb)",
       shcore::opts::Range<int>(0, std::numeric_limits<int>::max()));
 
+  add_named_options(!flags.is_set(Option_flags::CONNECTION_ONLY))
+    (&storage.rest_max_connections, 8, SHCORE_REST_MAX_CONNECTIONS,
+      "Maximum number of idle connections to the object storage which are "
+      "kept alive, default is 8.",
+      [](const std::string &value, Source source) {
+        const auto max_connections = shcore::opts::Range<int>(
+            1, std::numeric_limits<int>::max())(value, source);
+
+        auto options = mysqlshdk::rest::transport_options();
+        options.max_connections = max_connections;
+        mysqlshdk::rest::set_transport_options(options);
+
+        return max_connections;
+      })
+    (&storage.rest_http2, false, SHCORE_REST_HTTP2,
+      "Negotiate HTTP/2 when connecting to the object storage, default is "
+      "false.",
+      [](const std::string &value, Source source) {
+        const auto http2 = shcore::opts::Basic_type<bool>()(value, source);
+
+        auto options = mysqlshdk::rest::transport_options();
+        options.http2 = http2;
+        mysqlshdk::rest::set_transport_options(options);
+
+        return http2;
+      });
+
 #ifdef _WIN32
   add_startup_options()
     (cmdline("--plugin-authentication-kerberos-client-mode=<mode>"),
@@ -581,6 +609,11 @@ Shell_options::Shell_options(
                 " are: " RESULTSET_DUMPER_FORMATS);
           return val;
         })
+    (&storage.table_sample_rows, k_default_table_sample_rows,
+        SHCORE_RESULT_FORMAT_TABLE_SAMPLE_ROWS,
+        "Number of rows used to calculate column widths in table format, 0 "
+        "to calculate them using column metadata.",
+        shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
     (&storage.interactive, false, SHCORE_INTERACTIVE,
         "Enables interactive mode", shcore::opts::Read_only<bool>())
     (&storage.db_name_cache, true, SHCORE_DB_NAME_CACHE,
@@ -674,7 +707,45 @@ Shell_options::Shell_options(
           }
 
           return level;
+        });
+
+  add_startup_options(!flags.is_set(Option_flags::CONNECTION_ONLY))
+    (cmdline("--log-async"), "Write the log asynchronously, using a "
+        "background thread. Reduces the overhead of logging in multi-threaded "
+        "operations.",
+        [this](const std::string&, const char*) {
+          storage.log_async = true;
         })
+    (cmdline("--sql-batch-size=<#>"), "In SQL batch mode, send up to <#> "
+        "consecutive INSERT, UPDATE, DELETE and REPLACE statements to the "
+        "server in a single multi-statement packet. Requires a classic "
+        "session. Default: 1 (disabled).",
+        [this](const std::string& option, const char* value) {
+          try {
+            storage.sql_batch_size = shcore::lexical_cast<int>(value);
+          } catch (...) {
+            storage.sql_batch_size = 0;
+          }
+
+          if (storage.sql_batch_size < 1) {
+            throw std::invalid_argument(shcore::str_format(
+                "Invalid value for %s: %s", option.c_str(), value));
+          }
+        })
+    (cmdline("--startup-profile"), "Print the time spent in each phase of "
+        "the startup to stderr, before executing the requested operation.",
+        [this](const std::string&, const char*) {
+          storage.startup_profile = true;
+        })
+    (cmdline("--lazy-init"), "Defer loading of plugins and initialization "
+        "of Python until they are needed. Plugins are not loaded when calling "
+        "an operation of a built-in object using the command line "
+        "integration.",
+        [this](const std::string&, const char*) {
+          storage.lazy_init = true;
+        });
+
+  add_named_options(!flags.is_set(Option_flags::CONNECTION_ONLY))
     (&storage.dba_log_sql, 0, SHCORE_DBA_LOG_SQL,
         cmdline("--dba-log-sql[={0|1|2}]"),
         "Log SQL statements executed by AdminAPI operations: "
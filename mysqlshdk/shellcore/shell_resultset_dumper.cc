@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <cstring>
 #include <deque>
 
 #include "ext/linenoise-ng/include/linenoise.h"
@@ -45,12 +46,43 @@
 
 #define MAX_DISPLAY_LENGTH 1024
 
-// max # of rows to pre-fetch when dumping resultsets with table formatting,
-// in order to calculate column widths
-static constexpr const int k_pre_fetch_result_rows = 1000;
+// max # of rows to pre-fetch when column widths are calculated using column
+// metadata, used only if width of some column is not bounded (i.e. TEXT)
+static constexpr const int k_unbounded_pre_fetch_result_rows = 100;
 
 namespace mysqlsh {
 
+#ifndef _WIN32
+namespace {
+
+constexpr uint64_t k_low_bits = 0x0101010101010101ULL;
+constexpr uint64_t k_high_bits = 0x8080808080808080ULL;
+
+inline bool has_zero_byte(uint64_t v) {
+  return (v - k_low_bits) & ~v & k_high_bits;
+}
+
+inline bool has_byte(uint64_t v, uint8_t byte) {
+  return has_zero_byte(v ^ (k_low_bits * byte));
+}
+
+/**
+ * Checks if the given eight bytes are ASCII characters which are printed
+ * as-is, each one of them taking exactly one byte and one screen space.
+ */
+inline bool is_plain_ascii(const char *text, bool print_ctrl) {
+  uint64_t v;
+  memcpy(&v, text, sizeof(v));
+
+  if ((v & k_high_bits) || has_zero_byte(v)) return false;
+
+  return !print_ctrl ||
+         !(has_byte(v, '\t') || has_byte(v, '\n') || has_byte(v, '\\'));
+}
+
+}  // namespace
+#endif
+
 /* Calculates the required buffer size and display size considering:
  * - Some single byte characters may require injection of escaped sequence \\
  * - Some multibyte characters are displayed in the space of a single character
@@ -154,14 +186,26 @@ std::tuple<size_t, size_t> get_utf8_sizes(const char *text, size_t length,
   }
 
 #else
+  const bool print_ctrl = flags.is_set(Print_flag::PRINT_CTRL);
+
   std::mblen(NULL, 0);
   while (index < end) {
-    int width = std::mblen(index, end - index);
+    // most of the data is plain ASCII, process it eight bytes at a time
+    if (end - index >= 8 && is_plain_ascii(index, print_ctrl)) {
+      char_count += 8;
+      byte_count += 8;
+      index += 8;
+      continue;
+    }
+
+    // ASCII characters are always single byte ones, no need to call mblen()
+    const auto c = static_cast<unsigned char>(*index);
+    int width = c > 0 && c < 0x80 ? 1 : std::mblen(index, end - index);
 
     // handles single byte characters
     if (width == 1) {
       // Controls characters to be printed add one extra char to the output
-      if (flags.is_set(Print_flag::PRINT_CTRL) &&
+      if (print_ctrl &&
           (*index == '\t' || *index == '\n' || *index == '\\')) {
         char_count++;
         byte_count++;
@@ -265,9 +309,52 @@ class Field_formatter {
     }
   }
 
+  /**
+   * Calculates the column widths using just the column metadata.
+   *
+   * @returns false if metadata does not limit the width of the values (i.e.
+   * TEXT or JSON columns), in such case rows need to be processed.
+   */
+  bool set_width_from_metadata(const mysqlshdk::db::Column &column) {
+    // This function is meant to be called only for tables
+    assert(m_format == ResultFormat::TABLE);
+    size_t length = column.get_length();
+
+    if (m_type == mysqlshdk::db::Type::Bit) {
+      length = shcore::bits_to_string_hex_size(length) + 2;
+    } else if (m_type == mysqlshdk::db::Type::Bytes) {
+      length = 2 + length * 2;
+    } else if (m_type == mysqlshdk::db::Type::Float ||
+               m_type == mysqlshdk::db::Type::Double) {
+      // length of the longest value produced by ftoa()/dtoa()
+      length = std::max<size_t>(length, 24);
+    }
+
+    if (0 == length || length > MAX_DISPLAY_LENGTH) return false;
+
+    // NULL
+    length = std::max<size_t>(length, 4);
+
+    if (!m_is_numeric && mysqlshdk::db::is_string_type(m_type) &&
+        m_type != mysqlshdk::db::Type::Bytes) {
+      // length is given in bytes, each multibyte character takes at least one
+      // screen space
+      m_max_mb_holes = std::max(m_max_mb_holes, length);
+    }
+
+    m_max_display_length = std::max(m_max_display_length, length);
+    m_max_buffer_length = std::max(m_max_buffer_length, length);
+    m_fixed_width = true;
+
+    return true;
+  }
+
   void process(const mysqlshdk::db::IRow *row, size_t index) {
     // This function is meant to be called only for tables
     assert(m_format == ResultFormat::TABLE);
+
+    if (m_fixed_width) return;
+
     size_t dlength{0};
     size_t blength{0};
 
@@ -283,6 +370,10 @@ class Field_formatter {
       // TODO (anyone): Implement support for --skip-binary-as-hex
       auto data = row->get_string_data(index);
       dlength = blength = 2 + data.second * 2;
+    } else if (m_type == mysqlshdk::db::Type::String) {
+      const auto data = row->get_string_data(index);
+      std::tie(dlength, blength) =
+          get_utf8_sizes(data.first, data.second, m_flags);
     } else {
       auto data = row->get_as_string(index);
       auto fsizes = get_utf8_sizes(data.c_str(), data.length(), m_flags);
@@ -345,6 +436,11 @@ class Field_formatter {
       data = tmp.data();
       length = tmp.size();
 
+      std::tie(display_size, buffer_size) =
+          get_utf8_sizes(data, length, m_flags);
+    } else if (m_type == mysqlshdk::db::Type::String) {
+      std::tie(data, length) = row->get_string_data(index);
+
       std::tie(display_size, buffer_size) =
           get_utf8_sizes(data, length, m_flags);
     } else {
@@ -377,6 +473,7 @@ class Field_formatter {
   size_t m_allocated;
   size_t m_zerofill;
   bool m_align_right;
+  bool m_fixed_width = false;
 
   size_t m_max_display_length;
   size_t m_max_buffer_length;
@@ -443,8 +540,8 @@ class Field_formatter {
     if (m_format == ResultFormat::TABLE) {
       // If some multibyte characters were found, we need to truncate the buffer
       // adding the 'lost' characters
-      buffer[std::min(m_allocated,
-                      m_max_display_length + (buffer_size - display_size))] = 0;
+      m_buffer.resize(std::min(
+          m_allocated, m_max_display_length + (buffer_size - display_size)));
     } else {
       m_buffer.resize(next_index);
     }
@@ -500,8 +597,13 @@ Resultset_dumper_base::Resultset_dumper_base(
       m_wrap_json(wrap_json),
       m_format(format),
       m_printer(std::move(printer)),
-      m_show_column_type_info(show_column_type_info) {
+      m_show_column_type_info(show_column_type_info),
+      m_table_sample_rows(Shell_options::k_default_table_sample_rows) {
   if (m_format == "ndjson") m_format = "json/raw";
+
+  if (const auto options = mysqlsh::current_shell_options(true)) {
+    m_table_sample_rows = options->get().table_sample_rows;
+  }
 }
 
 Resultset_dumper::Resultset_dumper(mysqlshdk::db::IResult *target,
@@ -918,16 +1020,31 @@ size_t Resultset_dumper_base::dump_table() {
   const size_t field_count = metadata.size();
   if (field_count == 0) return 0;
 
+  // if sampling is disabled, column widths are calculated using the metadata,
+  // rows are pre-fetched only if width of some column is not bounded
+  const bool use_metadata = 0 == m_table_sample_rows;
+  bool pre_fetch = !use_metadata;
+
   // Updates the max_length array with the maximum length between column name,
   // min column length and column max length
   for (size_t field_index = 0; field_index < field_count; field_index++) {
-    auto column = metadata[field_index];
+    const auto &column = metadata[field_index];
     fmt.emplace_back(ResultFormat::TABLE, column);
+
+    if (use_metadata && !fmt.back().set_width_from_metadata(column)) {
+      pre_fetch = true;
+    }
   }
 
-  pre_fetched_rows.reserve(k_pre_fetch_result_rows);
-  {
-    auto row = m_result->fetch_one();
+  const mysqlshdk::db::IRow *row = nullptr;
+
+  if (pre_fetch) {
+    const size_t pre_fetch_rows =
+        use_metadata ? k_unbounded_pre_fetch_result_rows : m_table_sample_rows;
+    pre_fetched_rows.reserve(std::min<size_t>(
+        pre_fetch_rows, Shell_options::k_default_table_sample_rows));
+
+    row = m_result->fetch_one();
     while (row && !m_cancelled.test()) {
       pre_fetched_rows.emplace_back(*row);
 
@@ -935,12 +1052,20 @@ size_t Resultset_dumper_base::dump_table() {
         fmt[field_index].process(row, field_index);
       }
 
-      if (pre_fetched_rows.size() >= k_pre_fetch_result_rows) break;
+      if (pre_fetched_rows.size() >= pre_fetch_rows) break;
 
       row = m_result->fetch_one();
     }
+
+    if (m_cancelled.test() || pre_fetched_rows.empty()) return 0;
+
+    row = nullptr;
+  } else {
+    // rows are streamed, first one is needed to detect an empty set
+    row = m_result->fetch_one();
+
+    if (!row) return 0;
   }
-  if (m_cancelled.test() || pre_fetched_rows.empty()) return 0;
 
   //-----------
 
@@ -967,49 +1092,47 @@ size_t Resultset_dumper_base::dump_table() {
   }
   m_printer->print(separator);
 
-  // Print pre-fetched records
-  for (const auto &row : pre_fetched_rows) {
+  // each record is formatted into a single line, which is printed at once
+  std::string line;
+  const auto print_record = [&](const mysqlshdk::db::IRow *record) {
     ++num_records;
-    m_printer->print("| ");
+    line.assign("| ");
 
     for (size_t field_index = 0; field_index < field_count; field_index++) {
-      if (fmt[field_index].put(&row, field_index)) {
-        m_printer->print(fmt[field_index].str());
+      if (fmt[field_index].put(record, field_index)) {
+        line.append(fmt[field_index].str());
       } else {
         assert(mysqlshdk::db::is_string_type(metadata[field_index].get_type()));
-        if (row.get_type(field_index) == mysqlshdk::db::Type::Bytes) {
+        if (record->get_type(field_index) == mysqlshdk::db::Type::Bytes) {
           const char *data;
           size_t length;
-          std::tie(data, length) = row.get_string_data(field_index);
-          m_printer->print(shcore::string_to_hex({data, length}));
+          std::tie(data, length) = record->get_string_data(field_index);
+          line.append(shcore::string_to_hex({data, length}));
         } else {
-          m_printer->print(row.get_as_string(field_index));
+          // printer stops at the first \0 character
+          line.append(record->get_as_string(field_index).c_str());
         }
       }
-      if (field_index < field_count - 1) m_printer->print(" | ");
+      if (field_index < field_count - 1) line.append(" | ");
     }
-    m_printer->print(" |\n");
+    line.append(" |\n");
+
+    m_printer->print(line);
+  };
+
+  // Print pre-fetched records
+  for (const auto &record : pre_fetched_rows) {
+    print_record(&record);
 
     if (m_cancelled.test()) break;
   }
+
   // Now prints the remaining records
   if (!m_cancelled.test()) {
-    auto row = m_result->fetch_one();
-    while (row && !m_cancelled.test()) {
-      ++num_records;
-      m_printer->print("| ");
+    if (!row) row = m_result->fetch_one();
 
-      for (size_t field_index = 0; field_index < field_count; field_index++) {
-        if (fmt[field_index].put(row, field_index)) {
-          m_printer->print(fmt[field_index].str());
-        } else {
-          assert(
-              mysqlshdk::db::is_string_type(metadata[field_index].get_type()));
-          m_printer->print(row->get_as_string(field_index));
-        }
-        if (field_index < field_count - 1) m_printer->print(" | ");
-      }
-      m_printer->print(" |\n");
+    while (row && !m_cancelled.test()) {
+      print_record(row);
       row = m_result->fetch_one();
     }
   }
@@ -93,6 +93,22 @@ bool dollar_quoted_strings(
   return session->dollar_quoted_strings();
 }
 
+/**
+ * Checks if statement can be sent in a multi-statement packet: it does not
+ * return a result set and cannot change the way following statements are
+ * parsed.
+ */
+bool is_batchable(std::string_view sql) {
+  mysqlshdk::utils::SQL_iterator it(sql);
+  const auto keyword = it.next_token();
+
+  for (const auto k : {"INSERT", "UPDATE", "DELETE", "REPLACE"}) {
+    if (shcore::str_caseeq(keyword, k)) return true;
+  }
+
+  return false;
+}
+
 }  // namespace
 
 // How many bytes at a time to process when executing large SQL scripts
@@ -245,6 +261,59 @@ bool Shell_sql::process_sql(std::string_view query, std::string_view delimiter,
   return ret_val;
 }
 
+bool Shell_sql::execute_batch(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    std::vector<std::string> *statements, std::vector<size_t> *lines) {
+  bool ret_val = true;
+  const auto force = mysqlsh::current_shell_options()->get().force;
+
+  while (!statements->empty()) {
+    mysqlshdk::db::mysql::Batch_result result;
+
+    try {
+      // Install kill query as ^C handler
+      shcore::Interrupt_handler interrupt(
+          []() { return true; },
+          [weak_session = std::weak_ptr<mysqlshdk::db::ISession>{session}]() {
+            mysqlshdk::db::kill_query(weak_session);
+          });
+
+      result = session->execute_batch(*statements);
+    } catch (const mysqlshdk::db::Error &e) {
+      print_exception(shcore::Exception::mysql_error_with_code_and_state(
+          e.what(), e.code(), e.sqlstate()));
+      ret_val = false;
+      break;
+    }
+
+    for (const auto &info : result.info) {
+      if (!info.empty()) {
+        mysqlsh::current_console()->print("\n" + info + "\n");
+      }
+    }
+
+    if (!result.error) break;
+
+    auto exc = shcore::Exception::mysql_error_with_code_and_state(
+        result.error->what(), result.error->code(), result.error->sqlstate());
+    exc.set_file_context("", (*lines)[result.executed]);
+    print_exception(exc);
+    ret_val = false;
+
+    if (!force) break;
+
+    // server has stopped at the failed statement, continue with the next one
+    statements->erase(statements->begin(),
+                      statements->begin() + result.executed + 1);
+    lines->erase(lines->begin(), lines->begin() + result.executed + 1);
+  }
+
+  statements->clear();
+  lines->clear();
+
+  return ret_val;
+}
+
 bool Shell_sql::handle_input_stream(std::istream *istream) {
   std::shared_ptr<mysqlshdk::db::ISession> session;
   {
@@ -255,35 +324,76 @@ bool Shell_sql::handle_input_stream(std::istream *istream) {
       session = s->get_core_session();
   }
 
+  const auto &options = mysqlsh::current_shell_options()->get();
+
+  // consecutive DML statements are sent in multi-statement packets, to avoid
+  // a round-trip per statement; results of such statements are not printed,
+  // so this is not used in interactive mode or if output is wrapped in JSON
+  std::shared_ptr<mysqlshdk::db::mysql::Session> batch_session;
+  std::vector<std::string> batch;
+  std::vector<size_t> batch_lines;
+  const auto batch_size = static_cast<size_t>(options.sql_batch_size);
+
+  if (session && batch_size > 1 && !options.interactive &&
+      options.wrap_json == "off" &&
+      mysqlshdk::db::replay::g_replay_mode ==
+          mysqlshdk::db::replay::Mode::Direct) {
+    batch_session =
+        std::dynamic_pointer_cast<mysqlshdk::db::mysql::Session>(session);
+  }
+
+  const auto flush_batch = [&]() {
+    return batch.empty() ? true
+                         : execute_batch(batch_session, &batch, &batch_lines);
+  };
+
   mysqlshdk::utils::Sql_splitter *splitter = nullptr;
-  if (!mysqlshdk::utils::iterate_sql_stream(
-          istream, k_sql_chunk_size,
-          [&](std::string_view s, std::string_view delim, size_t lnum, size_t) {
-            std::string_view file;
-
-            if (shcore::str_beginswith(s, "source"))
-              file = s.substr(6);
-            else if (shcore::str_beginswith(s, "\\."))
-              file = s.substr(2);
-
-            bool ret = false;
-            if (!file.empty())
-              ret =
-                  _owner->handle_shell_command("\\source " + std::string{file});
-            else if (!s.empty())
-              ret = process_sql(s, delim, lnum, session, splitter);
-            return ret ? ret : mysqlsh::current_shell_options()->get().force;
-          },
-          [](std::string_view err) {
-            mysqlsh::current_console()->print_error(std::string{err});
-          },
-          ansi_quotes_enabled(session), no_backslash_escapes_enabled(session),
-          dollar_quoted_strings(session), nullptr, &splitter)) {
+  bool ret_val = mysqlshdk::utils::iterate_sql_stream(
+      istream, k_sql_chunk_size,
+      [&](std::string_view s, std::string_view delim, size_t lnum, size_t) {
+        std::string_view file;
+
+        if (shcore::str_beginswith(s, "source"))
+          file = s.substr(6);
+        else if (shcore::str_beginswith(s, "\\."))
+          file = s.substr(2);
+
+        const auto dev_session = _owner->get_dev_session();
+
+        if (batch_session && dev_session && file.empty() && is_batchable(s) &&
+            dev_session->query_attributes().empty()) {
+          batch.emplace_back(s);
+          batch_lines.emplace_back(lnum);
+
+          if (batch.size() < batch_size || flush_batch()) return true;
+
+          return options.force;
+        }
+
+        // statements have to be executed in order
+        if (!flush_batch() && !options.force) return false;
+
+        bool ret = false;
+        if (!file.empty())
+          ret = _owner->handle_shell_command("\\source " + std::string{file});
+        else if (!s.empty())
+          ret = process_sql(s, delim, lnum, session, splitter);
+        return ret ? ret : options.force;
+      },
+      [](std::string_view err) {
+        mysqlsh::current_console()->print_error(std::string{err});
+      },
+      ansi_quotes_enabled(session), no_backslash_escapes_enabled(session),
+      dollar_quoted_strings(session), nullptr, &splitter);
+
+  if (ret_val && !flush_batch() && !options.force) ret_val = false;
+
+  if (!ret_val) {
     // signal error during input processing
     _result_processor(nullptr, {});
-    return false;
   }
-  return true;
+
+  return ret_val;
 }
 
 std::shared_ptr<mysqlshdk::db::ISession> Shell_sql::get_session() {
@@ -640,6 +640,8 @@ int main(int argc, char **argv) {
     logger = shcore::Logger::create_instance(
         options.log_file.empty() ? nullptr : options.log_file.c_str(),
         options.log_to_stderr, options.log_level);
+
+    if (options.log_async) logger->set_async(true);
   } catch (const std::exception &e) {
     fprintf(stderr, "%s\n", e.what());
     exit(1);
@@ -774,8 +776,10 @@ int main(int argc, char **argv) {
           }
 
           // Connect to the requested instance
+          auto connection_stage = shell->startup_stage("connection");
           shell->connect(target, true, std::move(extra_init),
                          !options.prompt_password);
+          connection_stage.call();
 
           // If redirect is requested, then reconnect to the right instance
           handle_redirect(shell, options.redirect_session);
@@ -814,6 +818,7 @@ int main(int argc, char **argv) {
       try {
         // initialize globals requested via command line (i.e. --cluster,
         // --replicaset)
+        const auto stage = shell->startup_stage("extra globals");
         shell->init_extra_globals();
       } catch (const shcore::Exception &e) {
         mysqlsh::current_console()->print_error(e.format());
@@ -822,6 +827,8 @@ int main(int argc, char **argv) {
 
       if (valid_color_capability) shell->load_prompt_theme(pick_prompt_theme());
 
+      if (options.startup_profile) shell->print_startup_profile();
+
       const auto shell_cli_operation = shell_options->get_shell_cli_operation();
 
       if (shell_cli_operation) {
@@ -575,6 +575,8 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
               : std::make_shared<mysqlsh::Shell_console>(custom_delegate)} {
   DEBUG_OBJ_ALLOC(Mysql_shell);
 
+  auto global_objects_stage = startup_stage("global objects");
+
   // Registers the interactive objects if required
   _global_shell = std::make_shared<mysqlsh::Shell>(this);
   _global_js_sys = std::make_shared<mysqlsh::Sys>(_shell.get());
@@ -603,6 +605,10 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
   INIT_MODULE(mysqlsh::mysql::Mysql);
   INIT_MODULE(mysqlsh::mysqlx::Mysqlx);
 
+  global_objects_stage.call();
+
+  auto shell_commands_stage = startup_stage("shell commands");
+
   set_sql_safe_for_logging(get_options()->get(SHCORE_HISTIGNORE).descr());
   // completion provider for shell \commands (must be the 1st)
   completer()->add_provider(shcore::IShell_core::Mode_mask::any(),
@@ -705,6 +711,10 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
       },
       true, shcore::IShell_core::Mode_mask(shcore::IShell_core::Mode::SQL),
       true, "\"'`");
+
+  shell_commands_stage.call();
+
+  const auto credential_store_stage = startup_stage("credential store");
   shcore::Credential_manager::get().initialize();
 }
 
@@ -712,10 +722,20 @@ Mysql_shell::~Mysql_shell() { DEBUG_OBJ_DEALLOC(Mysql_shell); }
 
 void Mysql_shell::finish_init() {
   // Python needs to be initialized in case there are python start files/plugins
-  // but we do this only once for the whole application.
-  if (mysqlshdk::utils::in_main_thread()) shell_context()->init_py();
+  // but we do this only once for the whole application. If initialization is
+  // deferred, Python is initialized on demand, when switching to Python mode or
+  // loading a Python file.
+  const auto lazy = options().lazy_init && is_builtin_cli_operation();
+
+  if (mysqlshdk::utils::in_main_thread() && !lazy) {
+    const auto stage = startup_stage("Python");
+    shell_context()->init_py();
+  }
 
-  Base_shell::finish_init();
+  {
+    const auto stage = startup_stage("scripting modes");
+    Base_shell::finish_init();
+  }
 
   // if Python is disabled it means we're creating another instance of shell in
   // a thread. because of that we don't want to initialize everything again for
@@ -723,16 +743,23 @@ void Mysql_shell::finish_init() {
   // Also the shell_cli_operation is not needed as context won't need that.
 
   if (mysqlshdk::utils::in_main_thread()) {
-    File_list startup_files;
-    get_startup_scripts(&startup_files);
-    load_files(startup_files, "startup files");
+    {
+      const auto stage = startup_stage("startup scripts");
+      File_list startup_files;
+      get_startup_scripts(&startup_files);
+      load_files(startup_files, "startup files");
+    }
 
-    File_list plugins;
-    get_plugins(&plugins);
-    load_files(plugins, "plugins");
+    if (lazy) {
+      log_info("Calling an operation of a built-in object, plugins are not "
+               "loaded");
+    } else {
+      load_plugins();
+    }
 
     auto shell_cli_operation = m_shell_options.get()->get_shell_cli_operation();
     if (shell_cli_operation) {
+      const auto stage = startup_stage("CLI providers");
       auto providers = shell_cli_operation->get_provider();
 
       providers->register_provider("dba", _global_dba);
@@ -793,6 +820,70 @@ void Mysql_shell::finish_init() {
   }
 }
 
+shcore::Scoped_callback Mysql_shell::startup_stage(const char *name) {
+  m_startup_profile.stage_begin(name);
+  return shcore::Scoped_callback{[this]() { m_startup_profile.stage_end(); }};
+}
+
+void Mysql_shell::print_startup_profile() const {
+  std::string profile = "Startup profile:\n";
+
+  for (const auto &stage : m_startup_profile.trace_points()) {
+    profile += shcore::str_format(
+        "%*s%-*s %10.3f ms\n", 2 * (stage.depth + 1), "",
+        32 - 2 * stage.depth, stage.note, stage.milliseconds_elapsed());
+  }
+
+  profile += shcore::str_format("  %-32s %10.3f ms\n", "total",
+                                m_startup_profile.total_milliseconds_elapsed());
+
+  current_console()->raw_print(profile, Output_stream::STDERR);
+}
+
+void Mysql_shell::load_plugins() {
+  const auto stage = startup_stage("plugins");
+
+  File_list plugins;
+  get_plugins(&plugins);
+  load_files(plugins, "plugins");
+}
+
+bool Mysql_shell::is_builtin_cli_operation() const {
+  const auto cli_operation = m_shell_options.get()->get_shell_cli_operation();
+
+  if (!cli_operation) {
+    return false;
+  }
+
+  const auto args = cli_operation->get_cmdline_arguments();
+
+  if (args.empty()) {
+    return false;
+  }
+
+  const auto &object = args[0];
+
+  // objects returned by the AdminAPI cannot be extended by plugins
+  if ("cluster" == object || "rs" == object || "clusterset" == object) {
+    return true;
+  }
+
+  // built-in global objects can be extended by plugins, operation needs to
+  // be a built-in one
+  std::shared_ptr<shcore::Cpp_object_bridge> global;
+
+  if ("dba" == object) {
+    global = _global_dba;
+  } else if ("shell" == object) {
+    global = _global_shell;
+  } else if ("util" == object) {
+    global = _global_util;
+  }
+
+  return global && args.size() > 1 && '-' != args[1][0] &&
+         global->get_function_metadata(shcore::to_camel_case(args[1]), true);
+}
+
 void Mysql_shell::load_files(const File_list &file_list,
                              const std::string &context) {
   // if plugins are found, switch to the appropriate mode and load all files
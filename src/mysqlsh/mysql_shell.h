@@ -37,6 +37,8 @@
 #include "modules/mod_sys.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/ssh/ssh_manager.h"
+#include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 #include "shellcore/base_shell.h"
 #include "shellcore/shell_core.h"
 #include "shellcore/shell_options.h"
@@ -115,6 +117,17 @@ class Mysql_shell : public mysqlsh::Base_shell {
 
   std::shared_ptr<mysqlsh::Shell> get_shell() const { return _global_shell; }
 
+  /**
+   * Starts a new stage of the startup profile, the stage ends when the returned
+   * object goes out of scope. Stages can be nested.
+   */
+  [[nodiscard]] shcore::Scoped_callback startup_stage(const char *name);
+
+  /**
+   * Prints time spent in each of the startup stages to stderr.
+   */
+  void print_startup_profile() const;
+
  protected:
   static void set_sql_safe_for_logging(const std::string &patterns);
 
@@ -157,6 +170,16 @@ class Mysql_shell : public mysqlsh::Base_shell {
 
   virtual void toggle_print() {}
 
+  void load_plugins();
+
+  /**
+   * Checks if the command line integration call targets an operation of one of
+   * the built-in objects, which can be executed without loading the plugins.
+   */
+  bool is_builtin_cli_operation() const;
+
+  mysqlshdk::utils::Profile_timer m_startup_profile;
+
 #ifdef FRIEND_TEST
   FRIEND_TEST(Cmdline_shell, check_password_history_linenoise);
   FRIEND_TEST(Cmdline_shell, check_history_overflow_del);
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures speed of compression and decompression, and the compression ratio,
+// of each of the codecs supported by dumps, at several compression levels.
+// Data is written and read in 256KB blocks, the way dump chunks are.
+//
+// Usage: bench_compression_codecs [input file]
+// If input file is not given, 64MB of generated text is used, pass a real
+// dump (i.e. unittest/data/sql/sakila-data.sql) to get representative ratios.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::IFile;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+constexpr std::size_t k_block_size = 256 * 1024;
+
+std::string generate_text(std::size_t length) {
+  static const std::vector<std::string> k_words = {
+      "Lorem",  "ipsum", "dolor",   "sit",    "amet,",      "consectetur",
+      "elit,",  "sed",   "do",      "tempor", "incididunt", "ut",
+      "labore", "et",    "dolore.", "magna",  "aliqua.",    "12345",
+      "\n",     "\t",    "2024-01-01 12:00:00"};
+
+  std::mt19937_64 generator{42};
+  std::uniform_int_distribution<std::size_t> distribution{0,
+                                                          k_words.size() - 1};
+  std::string result;
+
+  result.reserve(length + 32);
+
+  while (result.size() < length) {
+    result += k_words[distribution(generator)];
+    result += ' ';
+  }
+
+  result.resize(length);
+
+  return result;
+}
+
+std::string read_all(IFile *file) {
+  std::string result;
+  std::string buffer;
+
+  buffer.resize(k_block_size);
+
+  file->open(Mode::READ);
+
+  for (auto read_bytes = file->read(buffer.data(), buffer.size());
+       read_bytes > 0; read_bytes = file->read(buffer.data(), buffer.size())) {
+    result.append(buffer.data(), read_bytes);
+  }
+
+  file->close();
+
+  return result;
+}
+
+std::string compress(const std::string &data, Compression ctype,
+                     const std::string &level) {
+  auto memory = std::make_unique<Memory_file>("");
+  const auto output = memory.get();
+  const auto file = mysqlshdk::storage::make_file(std::move(memory), ctype,
+                                                  {{"level", level}});
+
+  file->open(Mode::WRITE);
+
+  for (std::size_t offset = 0; offset < data.size(); offset += k_block_size) {
+    file->write(data.data() + offset,
+                std::min(k_block_size, data.size() - offset));
+  }
+
+  file->close();
+
+  return output->content();
+}
+
+std::string decompress(const std::string &compressed, Compression ctype) {
+  auto memory = std::make_unique<Memory_file>("");
+  memory->set_content(compressed);
+  return read_all(
+      mysqlshdk::storage::make_file(std::move(memory), ctype).get());
+}
+
+double speed(std::size_t bytes, std::chrono::steady_clock::duration time) {
+  return bytes /
+         std::max(std::chrono::duration<double>(time).count(), 1e-9) /
+         (1024 * 1024);
+}
+
+void run(const std::string &data, Compression ctype, const std::string &level) {
+  const auto t_start = std::chrono::steady_clock::now();
+
+  const auto compressed = compress(data, ctype, level);
+
+  const auto t_compressed = std::chrono::steady_clock::now();
+
+  const auto decompressed = decompress(compressed, ctype);
+
+  const auto t_end = std::chrono::steady_clock::now();
+
+  std::cout << "# " << mysqlshdk::storage::to_string(ctype)
+            << ";level=" << level << ": " << data.size() << " -> "
+            << compressed.size() << " bytes, ratio: "
+            << static_cast<double>(data.size()) /
+                   std::max<std::size_t>(compressed.size(), 1)
+            << ", compression: " << speed(data.size(), t_compressed - t_start)
+            << " MB/s, decompression: "
+            << speed(data.size(), t_end - t_compressed) << " MB/s"
+            << (data == decompressed ? "" : " (data mismatch)") << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const auto data = argc > 1
+                        ? read_all(mysqlshdk::storage::make_file(argv[1]).get())
+                        : generate_text(64 * 1024 * 1024);
+
+  const std::vector<std::pair<Compression, std::vector<std::string>>> codecs =
+      {{Compression::GZIP, {"1", "6", "9"}},
+       {Compression::ZSTD, {"1", "3", "9"}},
+       {Compression::LZ4, {"0", "1", "9", "12"}}};
+
+  for (const auto &codec : codecs) {
+    for (const auto &level : codec.second) {
+      run(data, codec.first, level);
+    }
+  }
+
+  return 0;
+}
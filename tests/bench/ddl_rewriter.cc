@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of the CREATE TABLE compatibility transformations, as
+// used by dump with ocimds, force_innodb and strip_tablespaces options:
+//  - check_create_table_for_*() functions, each one scanning and copying the
+//    whole statement,
+//  - the same functions called through Create_table_option_filter, which
+//    skips the ones whose keywords are not present, reused between statements.
+//
+// Usage: bench_ddl_rewriter [file with statements] [iterations]
+// Without a file, a set of built-in statements is used.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "modules/util/dump/compatibility.h"
+#include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace {
+
+using namespace mysqlsh::compatibility;
+
+const std::vector<std::string> k_default_statements = {
+    R"*(CREATE TABLE `orders` (
+  `id` bigint unsigned NOT NULL AUTO_INCREMENT,
+  `customer_id` int NOT NULL,
+  `created` datetime NOT NULL DEFAULT CURRENT_TIMESTAMP,
+  `status` enum('new','paid','shipped') NOT NULL DEFAULT 'new',
+  `comment` varchar(255) DEFAULT 'engine=MyISAM',
+  PRIMARY KEY (`id`),
+  KEY `customer` (`customer_id`,`created`)
+) ENGINE=MyISAM AUTO_INCREMENT=123456 DEFAULT CHARSET=utf8mb4
+  COLLATE=utf8mb4_0900_ai_ci ROW_FORMAT=FIXED)*",
+    R"*(CREATE TABLE `items` (
+  `order_id` bigint unsigned NOT NULL,
+  `line` smallint NOT NULL,
+  `sku` char(16) NOT NULL,
+  `price` decimal(10,2) NOT NULL,
+  `quantity` int NOT NULL DEFAULT '1',
+  PRIMARY KEY (`order_id`,`line`)
+) /*!50100 TABLESPACE `ts1` */ ENGINE=InnoDB DEFAULT CHARSET=utf8mb4
+  ENCRYPTION='Y' DATA DIRECTORY='/data/items/')*",
+    R"*(CREATE TABLE `audit` (
+  `id` int NOT NULL,
+  `tbl` varchar(64) NOT NULL,
+  `op` varchar(16) NOT NULL,
+  `ts` timestamp NOT NULL,
+  PRIMARY KEY (`id`)
+) ENGINE=InnoDB DEFAULT CHARSET=latin1
+/*!50100 PARTITION BY RANGE (`id`)
+(PARTITION p0 VALUES LESS THAN (1000000) ENGINE = InnoDB,
+ PARTITION p1 VALUES LESS THAN MAXVALUE ENGINE = InnoDB) */)*",
+};
+
+std::vector<std::string> read_statements(const char *path) {
+  std::ifstream file{path};
+  std::stringstream contents;
+  contents << file.rdbuf();
+
+  std::vector<std::string> result;
+  mysqlshdk::utils::iterate_sql_stream(
+      &contents, 4098,
+      [&result](std::string_view stmt, std::string_view, size_t, size_t) {
+        if (shcore::str_ibeginswith(stmt, "CREATE TABLE")) {
+          result.emplace_back(stmt);
+        }
+
+        return true;
+      },
+      [](std::string_view msg) {
+        throw std::runtime_error(std::string{msg});
+      });
+
+  return result;
+}
+
+std::string legacy(std::string stmt) {
+  check_create_table_for_data_index_dir_option(stmt, &stmt);
+  check_create_table_for_encryption_option(stmt, &stmt);
+  check_create_table_for_engine_option(stmt, &stmt);
+  check_create_table_for_fixed_row_format(stmt, &stmt);
+  check_create_table_for_tablespace_option(stmt, &stmt);
+  return stmt;
+}
+
+const std::string &filtered(Create_table_option_filter *filter,
+                            const std::string &stmt) {
+  filter->reset(stmt);
+  filter->data_index_dir_option(true);
+  filter->encryption_option(true);
+  filter->engine_option(true);
+  filter->fixed_row_format(true);
+  filter->tablespace_option(true);
+  return filter->statement();
+}
+
+void run(const char *name, std::size_t statements, std::size_t bytes,
+         const std::function<void()> &callback) {
+  const auto t_start = std::chrono::steady_clock::now();
+
+  callback();
+
+  const auto t_end = std::chrono::steady_clock::now();
+  const auto seconds =
+      std::max(std::chrono::duration<double>(t_end - t_start).count(), 1e-9);
+
+  std::cout << "# " << name << ": " << statements << " statements in "
+            << seconds << "s, " << statements / seconds << " statements/s, "
+            << bytes / seconds / (1024 * 1024) << " MB/s\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const auto statements =
+      argc > 1 ? read_statements(argv[1]) : k_default_statements;
+  const std::size_t iterations = argc > 2 ? std::stoul(argv[2]) : 100000;
+  const auto total = statements.size() * iterations;
+
+  std::size_t bytes = 0;
+
+  for (const auto &stmt : statements) {
+    bytes += stmt.size();
+  }
+
+  bytes *= iterations;
+
+  std::size_t mismatches = 0;
+  Create_table_option_filter filter;
+
+  for (const auto &stmt : statements) {
+    if (legacy(stmt) != filtered(&filter, stmt)) {
+      ++mismatches;
+    }
+  }
+
+  std::size_t size = 0;
+
+  run("check_create_table_for_*()", total, bytes, [&]() {
+    for (std::size_t i = 0; i < iterations; ++i) {
+      for (const auto &stmt : statements) {
+        size += legacy(stmt).size();
+      }
+    }
+  });
+
+  run("Create_table_option_filter", total, bytes, [&]() {
+    for (std::size_t i = 0; i < iterations; ++i) {
+      for (const auto &stmt : statements) {
+        size += filtered(&filter, stmt).size();
+      }
+    }
+  });
+
+  std::cout << "# " << statements.size() << " statements, " << mismatches
+            << " mismatches, " << size << " bytes written\n";
+
+  return mismatches ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of reading compressed dump chunks the way LOAD DATA
+// LOCAL INFILE does it: the file is sent in packets, after each packet the
+// client waits for the server to process it, this is simulated by sleeping
+// after each read. Each compression type is read:
+//  - inline, decompressing each packet when it's requested,
+//  - with read-ahead, decompressing the next block while the client waits.
+//
+// Usage: bench_read_ahead [MB of data] [server time per packet in us]
+// Defaults to 32MB of data and 200us per packet.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::IFile;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+constexpr std::size_t k_packet_size = 64 * 1024;
+
+std::string generate_text(std::size_t length) {
+  static const std::vector<std::string> k_words = {
+      "Lorem",  "ipsum", "dolor",   "sit",    "amet,",      "consectetur",
+      "elit,",  "sed",   "do",      "tempor", "incididunt", "ut",
+      "labore", "et",    "dolore.", "magna",  "aliqua.",    "12345",
+      "\n",     "\t",    "2024-01-01 12:00:00"};
+
+  std::mt19937_64 generator{42};
+  std::uniform_int_distribution<std::size_t> distribution{0,
+                                                          k_words.size() - 1};
+  std::string result;
+
+  result.reserve(length + 32);
+
+  while (result.size() < length) {
+    result += k_words[distribution(generator)];
+    result += ' ';
+  }
+
+  result.resize(length);
+
+  return result;
+}
+
+std::string compress(const std::string &data, Compression ctype) {
+  auto memory = std::make_unique<Memory_file>("");
+  const auto output = memory.get();
+  const auto file = mysqlshdk::storage::make_file(std::move(memory), ctype);
+
+  file->open(Mode::WRITE);
+  file->write(data.data(), data.size());
+  file->close();
+
+  return output->content();
+}
+
+std::unique_ptr<IFile> compressed_file(const std::string &compressed,
+                                       Compression ctype) {
+  auto memory = std::make_unique<Memory_file>("");
+  memory->set_content(compressed);
+  return mysqlshdk::storage::make_file(std::move(memory), ctype);
+}
+
+/**
+ * Reads the whole file in packets, waiting after each one.
+ *
+ * @returns number of bytes read
+ */
+std::size_t load(IFile *file, std::chrono::microseconds server_time) {
+  std::string buffer;
+  std::size_t bytes = 0;
+
+  buffer.resize(k_packet_size);
+
+  file->open(Mode::READ);
+
+  for (auto read_bytes = file->read(buffer.data(), buffer.size());
+       read_bytes > 0; read_bytes = file->read(buffer.data(), buffer.size())) {
+    bytes += read_bytes;
+    std::this_thread::sleep_for(server_time);
+  }
+
+  file->close();
+
+  return bytes;
+}
+
+void run(const std::string &name, std::unique_ptr<IFile> file,
+         std::size_t expected, std::chrono::microseconds server_time) {
+  const auto t_start = std::chrono::steady_clock::now();
+
+  const auto bytes = load(file.get(), server_time);
+
+  const auto t_end = std::chrono::steady_clock::now();
+  const auto seconds =
+      std::max(std::chrono::duration<double>(t_end - t_start).count(), 1e-9);
+
+  std::cout << "# " << name << ": " << bytes << " bytes in " << seconds
+            << "s, " << bytes / seconds / (1024 * 1024) << " MB/s"
+            << (bytes == expected ? "" : " (size mismatch)") << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const std::size_t megabytes = argc > 1 ? std::stoul(argv[1]) : 32;
+  const std::chrono::microseconds server_time{argc > 2 ? std::stoul(argv[2])
+                                                       : 200};
+  const auto data = generate_text(megabytes * 1024 * 1024);
+
+  for (const auto ctype :
+       {Compression::GZIP, Compression::ZSTD, Compression::LZ4}) {
+    const auto name = mysqlshdk::storage::to_string(ctype);
+    const auto compressed = compress(data, ctype);
+
+    run(name + " inline", compressed_file(compressed, ctype), data.size(),
+        server_time);
+    run(name + " read-ahead",
+        mysqlshdk::storage::read_ahead(compressed_file(compressed, ctype)),
+        data.size(), server_time);
+  }
+
+  return 0;
+}
@@ -0,0 +1,586 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Replays synthetic session traces at full speed, without a server, and
+// measures the client-side cost of processing the results. Traces are written
+// by the same Trace_writer which is used to record the replayed tests, so the
+// data goes through the same code paths. Each scenario mimics the queries and
+// the shapes of the results of an operation:
+//  - util.dumpInstance(): metadata of the tables and their columns, DDL of
+//    each table and a chunk of data from each table,
+//  - cluster.status(): metadata of the cluster, group membership, statistics
+//    and configuration of each member, repeated a number of times,
+//  - util.checkForServerUpgrade(): a series of INFORMATION_SCHEMA checks, most
+//    of them finding nothing, some reporting a lot of objects,
+//  - result set printing: a result set formatted as a table and vertically,
+//  - raw access to a result set, as strings and using the typed getters.
+//
+// Usage: bench_replay [scale]
+// Scale multiplies the number of objects and rows, defaults to 1.
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
+#include "mysqlshdk/libs/db/replay/replayer.h"
+#include "mysqlshdk/libs/db/replay/setup.h"
+#include "mysqlshdk/libs/db/replay/trace.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/utils/log_sql.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace {
+
+using mysqlshdk::db::IResult;
+using mysqlshdk::db::Mutable_result;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+
+using Columns = std::vector<std::pair<std::string, Type>>;
+using Generator =
+    std::function<std::string(std::size_t row, std::size_t column)>;
+using Processor = std::function<std::size_t(IResult *)>;
+
+const mysqlshdk::db::Connection_options k_options{"root@localhost:3306"};
+
+/**
+ * A query and its result.
+ */
+struct Step {
+  std::string query;
+  std::shared_ptr<Mutable_result> result;
+};
+
+Step step(std::string query, const Columns &columns, std::size_t rows,
+          const Generator &value) {
+  std::vector<mysqlshdk::db::Column> metadata;
+  std::vector<Type> types;
+
+  for (const auto &column : columns) {
+    metadata.emplace_back(Mutable_result::make_column(column.first,
+                                                      column.second));
+    types.emplace_back(column.second);
+  }
+
+  auto result = std::make_shared<Mutable_result>(metadata);
+
+  for (std::size_t r = 0; r < rows; ++r) {
+    auto row = std::make_unique<Mutable_row>(types);
+
+    for (std::size_t c = 0; c < types.size(); ++c) {
+      auto v = value(r, c);
+
+      switch (types[c]) {
+        case Type::Integer:
+          row->set_field(c, static_cast<int64_t>(std::stoll(v)));
+          break;
+
+        case Type::UInteger:
+          row->set_field(c, static_cast<uint64_t>(std::stoull(v)));
+          break;
+
+        case Type::Double:
+          row->set_field(c, std::stod(v));
+          break;
+
+        default:
+          row->set_field(c, std::move(v));
+          break;
+      }
+    }
+
+    result->add_row(std::move(row));
+  }
+
+  return {std::move(query), std::move(result)};
+}
+
+std::size_t as_strings(IResult *result) {
+  std::size_t bytes = 0;
+
+  while (const auto row = result->fetch_one()) {
+    for (uint32_t i = 0; i < row->num_fields(); ++i) {
+      bytes += row->get_as_string(i).size();
+    }
+  }
+
+  return bytes;
+}
+
+/**
+ * Writes a trace of a session which executes the given queries, then replays
+ * it, processing each result with the given function.
+ */
+void run(const char *name, const std::string &context,
+         const std::vector<Step> &steps, const Processor &process) {
+  using namespace mysqlshdk::db::replay;
+
+  std::size_t rows = 0;
+
+  {
+    begin_recording_context(context);
+
+    auto writer = Trace_writer::create(new_recording_path("mysql_trace"));
+
+    writer->serialize_connect(k_options, "classic");
+    writer->serialize_connect_ok({{"server_version", "8.4.0"},
+                                  {"connection_id", "1"},
+                                  {"protocol_info", "10"}});
+
+    for (const auto &s : steps) {
+      rows += s.result->get_fetched_row_count();
+
+      writer->serialize_query(s.query);
+      writer->serialize_result(s.result, {});
+    }
+
+    writer->serialize_close();
+    writer->serialize_ok();
+  }
+
+  begin_recording_context(context);
+
+  std::size_t bytes = 0;
+  const auto t_start = std::chrono::steady_clock::now();
+  const auto cpu_start = std::clock();
+
+  {
+    auto session = std::make_shared<Replayer_mysql>();
+    session->connect(k_options);
+
+    for (const auto &s : steps) {
+      bytes += process(session->query(s.query).get());
+    }
+
+    session->close();
+  }
+
+  const auto cpu =
+      static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+  const auto seconds = std::max(
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start)
+          .count(),
+      1e-9);
+
+  std::cout << "# " << name << ": " << steps.size() << " queries, " << rows
+            << " rows, " << bytes << " bytes in " << seconds << "s (cpu "
+            << cpu << "s), " << rows / seconds << " rows/s, "
+            << steps.size() / seconds << " queries/s\n";
+}
+
+std::string table_name(std::size_t t) { return "t" + std::to_string(t); }
+
+std::string create_table(std::size_t t) {
+  return "CREATE TABLE `" + table_name(t) +
+         R"*(` (
+  `id` bigint unsigned NOT NULL AUTO_INCREMENT,
+  `customer_id` int NOT NULL,
+  `name` varchar(64) NOT NULL,
+  `amount` decimal(10,2) NOT NULL,
+  `status` enum('new','paid','shipped') NOT NULL DEFAULT 'new',
+  `comment` text,
+  `created` datetime NOT NULL DEFAULT CURRENT_TIMESTAMP,
+  `updated` timestamp NULL DEFAULT NULL ON UPDATE CURRENT_TIMESTAMP,
+  PRIMARY KEY (`id`),
+  KEY `customer` (`customer_id`,`created`)
+) ENGINE=InnoDB AUTO_INCREMENT=123456 DEFAULT CHARSET=utf8mb4
+  COLLATE=utf8mb4_0900_ai_ci)*";
+}
+
+std::vector<Step> dump_instance(std::size_t scale) {
+  const std::size_t tables = 50 * scale;
+  constexpr std::size_t k_columns = 8;
+  constexpr std::size_t k_chunk = 1000;
+  const char *column_names[k_columns] = {"id",      "customer_id", "name",
+                                         "amount",  "status",      "comment",
+                                         "created", "updated"};
+
+  std::vector<Step> steps;
+
+  steps.emplace_back(step(
+      "SELECT TABLE_NAME, TABLE_TYPE, ENGINE, TABLE_ROWS, AVG_ROW_LENGTH, "
+      "DATA_LENGTH, TABLE_COMMENT FROM information_schema.tables WHERE "
+      "TABLE_SCHEMA = 'sakila'",
+      {{"TABLE_NAME", Type::String},
+       {"TABLE_TYPE", Type::String},
+       {"ENGINE", Type::String},
+       {"TABLE_ROWS", Type::UInteger},
+       {"AVG_ROW_LENGTH", Type::UInteger},
+       {"DATA_LENGTH", Type::UInteger},
+       {"TABLE_COMMENT", Type::String}},
+      tables, [](std::size_t r, std::size_t c) -> std::string {
+        switch (c) {
+          case 0:
+            return table_name(r);
+          case 1:
+            return "BASE TABLE";
+          case 2:
+            return "InnoDB";
+          case 3:
+            return "100000";
+          case 4:
+            return "120";
+          case 5:
+            return "12000000";
+          default:
+            return "";
+        }
+      }));
+
+  steps.emplace_back(step(
+      "SELECT TABLE_NAME, COLUMN_NAME, DATA_TYPE, COLUMN_TYPE, IS_NULLABLE, "
+      "COLUMN_KEY, EXTRA, ORDINAL_POSITION FROM information_schema.columns "
+      "WHERE TABLE_SCHEMA = 'sakila' ORDER BY TABLE_NAME, ORDINAL_POSITION",
+      {{"TABLE_NAME", Type::String},
+       {"COLUMN_NAME", Type::String},
+       {"DATA_TYPE", Type::String},
+       {"COLUMN_TYPE", Type::String},
+       {"IS_NULLABLE", Type::String},
+       {"COLUMN_KEY", Type::String},
+       {"EXTRA", Type::String},
+       {"ORDINAL_POSITION", Type::UInteger}},
+      tables * k_columns,
+      [&column_names](std::size_t r, std::size_t c) -> std::string {
+        const auto column = r % k_columns;
+
+        switch (c) {
+          case 0:
+            return table_name(r / k_columns);
+          case 1:
+            return column_names[column];
+          case 2:
+          case 3:
+            return column < 2 ? "bigint" : "varchar";
+          case 4:
+            return column < 4 ? "NO" : "YES";
+          case 5:
+            return 0 == column ? "PRI" : (1 == column ? "MUL" : "");
+          case 6:
+            return 0 == column ? "auto_increment" : "";
+          default:
+            return std::to_string(column + 1);
+        }
+      }));
+
+  for (std::size_t t = 0; t < tables; ++t) {
+    steps.emplace_back(step(
+        "SHOW CREATE TABLE `sakila`.`" + table_name(t) + "`",
+        {{"Table", Type::String}, {"Create Table", Type::String}}, 1,
+        [t](std::size_t, std::size_t c) {
+          return 0 == c ? table_name(t) : create_table(t);
+        }));
+  }
+
+  for (std::size_t t = 0; t < tables; ++t) {
+    steps.emplace_back(step(
+        "SELECT SQL_NO_CACHE `id`,`customer_id`,`name`,`amount`,`status`,"
+        "`comment`,`created`,`updated` FROM `sakila`.`" +
+            table_name(t) + "` WHERE (`id` BETWEEN 1 AND 1000) ORDER BY `id`",
+        {{"id", Type::UInteger},
+         {"customer_id", Type::Integer},
+         {"name", Type::String},
+         {"amount", Type::Decimal},
+         {"status", Type::Enum},
+         {"comment", Type::String},
+         {"created", Type::DateTime},
+         {"updated", Type::DateTime}},
+        k_chunk, [](std::size_t r, std::size_t c) -> std::string {
+          switch (c) {
+            case 0:
+              return std::to_string(r + 1);
+            case 1:
+              return std::to_string(r % 599);
+            case 2:
+              return "customer name " + std::to_string(r);
+            case 3:
+              return std::to_string(r % 1000) + ".99";
+            case 4:
+              return "paid";
+            case 5:
+              return std::string(r % 200, 'c');
+            default:
+              return "2024-01-01 12:00:00";
+          }
+        }));
+  }
+
+  return steps;
+}
+
+std::vector<Step> cluster_status(std::size_t scale) {
+  const std::size_t iterations = 20 * scale;
+  constexpr std::size_t k_members = 3;
+  constexpr std::size_t k_variables = 60;
+
+  const auto host = [](std::size_t m) {
+    return "mysql-" + std::to_string(m) + ".example.com";
+  };
+  const auto uuid = [](std::size_t m) {
+    return "3e11fa47-71ca-11e1-9e33-c80aa9429" + std::to_string(560 + m);
+  };
+
+  std::vector<Step> steps;
+
+  for (std::size_t i = 0; i < iterations; ++i) {
+    steps.emplace_back(step(
+        "SELECT i.instance_id, i.cluster_id, i.address, i.mysql_server_uuid, "
+        "i.instance_name, i.attributes FROM "
+        "mysql_innodb_cluster_metadata.instances i",
+        {{"instance_id", Type::UInteger},
+         {"cluster_id", Type::String},
+         {"address", Type::String},
+         {"mysql_server_uuid", Type::String},
+         {"instance_name", Type::String},
+         {"attributes", Type::Json}},
+        k_members, [&](std::size_t r, std::size_t c) -> std::string {
+          switch (c) {
+            case 0:
+              return std::to_string(r + 1);
+            case 1:
+              return "a6d2b3e4-71ca-11e1-9e33-c80aa9429562";
+            case 2:
+            case 4:
+              return host(r) + ":3306";
+            case 3:
+              return uuid(r);
+            default:
+              return R"({"server_id": )" + std::to_string(r + 1) +
+                     R"(, "recoveryAccountUser": "mysql_innodb_cluster_)" +
+                     std::to_string(r + 1) + R"(", "recoveryAccountHost": )"
+                     R"("%"})";
+          }
+        }));
+
+    for (std::size_t m = 0; m < k_members; ++m) {
+      steps.emplace_back(step(
+          "SELECT CHANNEL_NAME, MEMBER_ID, MEMBER_HOST, MEMBER_PORT, "
+          "MEMBER_STATE, MEMBER_ROLE, MEMBER_VERSION FROM "
+          "performance_schema.replication_group_members",
+          {{"CHANNEL_NAME", Type::String},
+           {"MEMBER_ID", Type::String},
+           {"MEMBER_HOST", Type::String},
+           {"MEMBER_PORT", Type::UInteger},
+           {"MEMBER_STATE", Type::String},
+           {"MEMBER_ROLE", Type::String},
+           {"MEMBER_VERSION", Type::String}},
+          k_members, [&](std::size_t r, std::size_t c) -> std::string {
+            switch (c) {
+              case 0:
+                return "group_replication_applier";
+              case 1:
+                return uuid(r);
+              case 2:
+                return host(r);
+              case 3:
+                return "3306";
+              case 4:
+                return "ONLINE";
+              case 5:
+                return 0 == r ? "PRIMARY" : "SECONDARY";
+              default:
+                return "8.4.0";
+            }
+          }));
+
+      steps.emplace_back(step(
+          "SELECT MEMBER_ID, COUNT_TRANSACTIONS_IN_QUEUE, "
+          "COUNT_TRANSACTIONS_CHECKED, COUNT_CONFLICTS_DETECTED, "
+          "COUNT_TRANSACTIONS_ROWS_VALIDATING, "
+          "COUNT_TRANSACTIONS_REMOTE_IN_APPLIER_QUEUE, "
+          "COUNT_TRANSACTIONS_REMOTE_APPLIED, "
+          "COUNT_TRANSACTIONS_LOCAL_PROPOSED, "
+          "COUNT_TRANSACTIONS_LOCAL_ROLLBACK, "
+          "TRANSACTIONS_COMMITTED_ALL_MEMBERS "
+          "FROM performance_schema.replication_group_member_stats",
+          {{"MEMBER_ID", Type::String},
+           {"COUNT_TRANSACTIONS_IN_QUEUE", Type::UInteger},
+           {"COUNT_TRANSACTIONS_CHECKED", Type::UInteger},
+           {"COUNT_CONFLICTS_DETECTED", Type::UInteger},
+           {"COUNT_TRANSACTIONS_ROWS_VALIDATING", Type::UInteger},
+           {"COUNT_TRANSACTIONS_REMOTE_IN_APPLIER_QUEUE", Type::UInteger},
+           {"COUNT_TRANSACTIONS_REMOTE_APPLIED", Type::UInteger},
+           {"COUNT_TRANSACTIONS_LOCAL_PROPOSED", Type::UInteger},
+           {"COUNT_TRANSACTIONS_LOCAL_ROLLBACK", Type::UInteger},
+           {"TRANSACTIONS_COMMITTED_ALL_MEMBERS", Type::String}},
+          k_members, [&](std::size_t r, std::size_t c) -> std::string {
+            switch (c) {
+              case 0:
+                return uuid(r);
+              case 9:
+                return "a6d2b3e4-71ca-11e1-9e33-c80aa9429562:1-123456";
+              default:
+                return std::to_string(r * 1000 + c);
+            }
+          }));
+
+      steps.emplace_back(step(
+          "SHOW GLOBAL VARIABLES LIKE 'group_replication_%'",
+          {{"Variable_name", Type::String}, {"Value", Type::String}},
+          k_variables, [](std::size_t r, std::size_t c) -> std::string {
+            return 0 == c ? "group_replication_variable_" + std::to_string(r)
+                          : std::to_string(r * 17);
+          }));
+    }
+  }
+
+  return steps;
+}
+
+std::vector<Step> upgrade_checker(std::size_t scale) {
+  constexpr std::size_t k_checks = 40;
+  const std::size_t issues = 200 * scale;
+
+  std::vector<Step> steps;
+
+  for (std::size_t i = 0; i < k_checks; ++i) {
+    // most of the checks do not find anything, every fifth one reports a lot
+    // of objects
+    steps.emplace_back(step(
+        "SELECT TABLE_SCHEMA, TABLE_NAME, COLUMN_NAME, "
+        "CONCAT('check #" +
+            std::to_string(i) +
+            "') AS DETAIL FROM information_schema.columns WHERE "
+            "TABLE_SCHEMA NOT IN ('information_schema', 'performance_schema', "
+            "'mysql', 'sys') AND DATA_TYPE IN ('check', '" +
+            std::to_string(i) + "')",
+        {{"TABLE_SCHEMA", Type::String},
+         {"TABLE_NAME", Type::String},
+         {"COLUMN_NAME", Type::String},
+         {"DETAIL", Type::String}},
+        0 == i % 5 ? issues : 0,
+        [i](std::size_t r, std::size_t c) -> std::string {
+          switch (c) {
+            case 0:
+              return "schema_" + std::to_string(r % 10);
+            case 1:
+              return table_name(r);
+            case 2:
+              return "column_" + std::to_string(r % 8);
+            default:
+              return "check #" + std::to_string(i) +
+                     " found an issue with this column, which needs to be "
+                     "fixed before the upgrade";
+          }
+        }));
+  }
+
+  return steps;
+}
+
+std::vector<Step> result_set(std::size_t rows) {
+  std::vector<Step> steps;
+
+  steps.emplace_back(step(
+      "SELECT * FROM sakila.payment",
+      {{"id", Type::UInteger},
+       {"name", Type::String},
+       {"amount", Type::Decimal},
+       {"created", Type::DateTime}},
+      rows, [](std::size_t r, std::size_t c) -> std::string {
+        switch (c) {
+          case 0:
+            return std::to_string(r);
+          case 1:
+            return "name of the row number " + std::to_string(r);
+          case 2:
+            return std::to_string(r % 1000) + ".25";
+          default:
+            return "2024-01-01 12:00:00";
+        }
+      }));
+
+  return steps;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const std::size_t scale = argc > 1 ? std::stoul(argv[1]) : 1;
+  const auto tmpdir = shcore::path::join_path(shcore::path::tmpdir(),
+                                              "mysqlsh_bench_replay");
+
+  if (shcore::is_folder(tmpdir)) {
+    shcore::remove_directory(tmpdir, true);
+  }
+
+  shcore::create_directory(tmpdir, true);
+  mysqlshdk::db::replay::set_recording_path_prefix(
+      shcore::path::join_path(tmpdir, ""));
+
+  mysqlsh::Scoped_shell_options options{
+      std::make_shared<mysqlsh::Shell_options>()};
+  mysqlsh::Scoped_logger logger{shcore::Logger::create_instance(
+      shcore::path::join_path(tmpdir, "mysqlsh.log").c_str(), false,
+      shcore::Logger::LOG_WARNING)};
+  mysqlsh::Scoped_log_sql log_sql{std::make_shared<shcore::Log_sql>()};
+
+  run("dumpInstance", "dump_instance", dump_instance(scale), as_strings);
+
+  run("cluster.status", "cluster_status", cluster_status(scale), as_strings);
+
+  run("upgrade checker", "upgrade_checker", upgrade_checker(scale),
+      as_strings);
+
+  run("result set as strings", "result_set", result_set(20000 * scale),
+      as_strings);
+
+  run("result set typed access", "typed_access", result_set(20000 * scale),
+      [](IResult *result) {
+        std::size_t bytes = 0;
+
+        while (const auto row = result->fetch_one()) {
+          bytes += sizeof(row->get_uint(0));
+          bytes += row->get_string_data(1).second;
+        }
+
+        return bytes;
+      });
+
+  run("result set printed as table", "print_table", result_set(5000 * scale),
+      [](IResult *result) {
+        return mysqlsh::Resultset_writer{result}.write_table().size();
+      });
+
+  run("result set printed vertically", "print_vertical",
+      result_set(5000 * scale), [](IResult *result) {
+        return mysqlsh::Resultset_writer{result}.write_vertical().size();
+      });
+
+  shcore::remove_directory(tmpdir, true);
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Compares the CPU cost of computing the payload hash of S3 upload parts:
+//  - two-pass: part is buffered, then hashed once it's sealed,
+//  - fused: hash is updated while data is appended to the buffer,
+//  - unsigned: no hash is computed (UNSIGNED-PAYLOAD).
+
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
+
+namespace {
+
+constexpr std::size_t k_part_size = 8 * 1024 * 1024;
+constexpr std::size_t k_write_size = 64 * 1024;
+constexpr std::size_t k_total_size = 1024 * 1024 * 1024;
+
+void run(const char *name,
+         const std::function<void(const std::string &, std::string *)> &append,
+         const std::function<void(const std::string &)> &seal) {
+  const std::string chunk(k_write_size, 'x');
+  std::string part;
+  part.reserve(k_part_size);
+
+  const auto t_start = std::clock();
+
+  for (std::size_t total = 0; total < k_total_size; total += k_write_size) {
+    append(chunk, &part);
+
+    if (part.size() >= k_part_size) {
+      seal(part);
+      part.clear();
+    }
+  }
+
+  if (!part.empty()) {
+    seal(part);
+  }
+
+  const auto cpu_ms = 1000.0 * (std::clock() - t_start) / CLOCKS_PER_SEC;
+
+  std::cout << "# " << name << ": " << cpu_ms << "ms of CPU time per GB\n";
+}
+
+}  // namespace
+
+int main() {
+  std::vector<unsigned char> hash;
+
+  run(
+      "two-pass",
+      [](const std::string &chunk, std::string *part) { part->append(chunk); },
+      [&hash](const std::string &part) {
+        hash = shcore::ssl::sha256(part.data(), part.size());
+      });
+
+  shcore::ssl::Sha256 sha;
+
+  run(
+      "fused",
+      [&sha](const std::string &chunk, std::string *part) {
+        part->append(chunk);
+        sha.update(chunk.data(), chunk.size());
+      },
+      [&sha, &hash](const std::string &) { hash = sha.digest(); });
+
+  run(
+      "unsigned",
+      [](const std::string &chunk, std::string *part) { part->append(chunk); },
+      [](const std::string &) {});
+
+  return hash.empty() ? 1 : 0;
+}
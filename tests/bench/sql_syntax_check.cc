@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of the SQL syntax check, in statements per second:
+//  - check_sql_syntax(), which creates a new lexer and parser for each call,
+//  - Sql_syntax_checker, reused by the calling thread,
+//  - Sql_syntax_checker, one per thread, using all available CPUs.
+//
+// Usage: bench_sql_syntax_check [file with statements] [iterations]
+// Without a file, a set of built-in routines is used.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// hack to workaround antlr4 trying to include Token.h but getting token.h from
+// Python in macos
+#define Py_LIMITED_API
+#include "mysqlshdk/libs/parser/mysql_parser_utils.h"
+
+namespace {
+
+using mysqlshdk::parser::Sql_syntax_checker;
+
+const std::vector<std::string> k_default_statements = {
+    R"*(CREATE DEFINER=`root`@`localhost` PROCEDURE `get_orders`(IN cid INT)
+BEGIN
+  DECLARE total INT DEFAULT 0;
+  SELECT COUNT(*) INTO total FROM orders WHERE customer_id = cid;
+  IF total > 10 THEN
+    UPDATE customers SET vip = 1 WHERE id = cid;
+  END IF;
+  SELECT o.id, o.created, SUM(i.price * i.quantity) AS value
+    FROM orders o JOIN items i ON i.order_id = o.id
+    WHERE o.customer_id = cid GROUP BY o.id ORDER BY o.created DESC;
+END)*",
+    R"*(CREATE DEFINER=`root`@`localhost` FUNCTION `discount`(p DECIMAL(10,2))
+RETURNS decimal(10,2) DETERMINISTIC
+BEGIN
+  RETURN CASE WHEN p > 1000 THEN p * 0.9 WHEN p > 100 THEN p * 0.95 ELSE p END;
+END)*",
+    R"*(CREATE DEFINER=`root`@`localhost` TRIGGER `orders_bi` BEFORE INSERT
+  ON `orders` FOR EACH ROW
+BEGIN
+  SET NEW.created = IFNULL(NEW.created, NOW());
+  INSERT INTO audit (tbl, op, ts) VALUES ('orders', 'insert', NOW());
+END)*",
+};
+
+std::vector<std::string> read_statements(const char *path) {
+  std::ifstream file{path};
+  std::stringstream contents;
+  contents << file.rdbuf();
+
+  std::vector<std::string> result;
+  mysqlshdk::utils::iterate_sql_stream(
+      &contents, 4098,
+      [&result](std::string_view stmt, std::string_view, size_t, size_t) {
+        result.emplace_back(stmt);
+        return true;
+      },
+      [](std::string_view msg) {
+        throw std::runtime_error(std::string{msg});
+      });
+
+  return result;
+}
+
+std::string wrap(const std::string &stmt) {
+  return "DELIMITER $$$\n" + stmt + "$$$\n";
+}
+
+void run(const char *name, std::size_t statements,
+         const std::function<void()> &callback) {
+  const auto t_start = std::chrono::steady_clock::now();
+
+  callback();
+
+  const auto t_end = std::chrono::steady_clock::now();
+  const auto seconds = std::chrono::duration<double>(t_end - t_start).count();
+
+  std::cout << "# " << name << ": " << statements << " statements in "
+            << seconds << "s, " << statements / std::max(seconds, 1e-9)
+            << " statements/s\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const auto statements =
+      argc > 1 ? read_statements(argv[1]) : k_default_statements;
+  const std::size_t iterations = argc > 2 ? std::stoul(argv[2]) : 1000;
+  const auto total = statements.size() * iterations;
+
+  std::size_t errors = 0;
+
+  run("check_sql_syntax()", total, [&]() {
+    for (std::size_t i = 0; i < iterations; ++i) {
+      for (const auto &stmt : statements) {
+        try {
+          mysqlshdk::parser::check_sql_syntax(wrap(stmt));
+        } catch (const mysqlshdk::parser::Sql_syntax_error &) {
+          ++errors;
+        }
+      }
+    }
+  });
+
+  std::size_t ll_fallbacks = 0;
+
+  run("Sql_syntax_checker", total, [&]() {
+    Sql_syntax_checker checker;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+      for (const auto &stmt : statements) {
+        try {
+          checker.check(wrap(stmt));
+        } catch (const mysqlshdk::parser::Sql_syntax_error &) {
+        }
+      }
+    }
+
+    ll_fallbacks = checker.ll_fallbacks();
+  });
+
+  const auto threads = std::max(1u, std::thread::hardware_concurrency());
+
+  run(("Sql_syntax_checker x " + std::to_string(threads)).c_str(), total,
+      [&]() {
+        std::atomic<std::size_t> next{0};
+        std::vector<std::thread> workers;
+
+        for (unsigned t = 0; t < threads; ++t) {
+          workers.emplace_back([&]() {
+            Sql_syntax_checker checker;
+
+            for (auto i = next++; i < total; i = next++) {
+              try {
+                checker.check(wrap(statements[i % statements.size()]));
+              } catch (const mysqlshdk::parser::Sql_syntax_error &) {
+              }
+            }
+          });
+        }
+
+        for (auto &worker : workers) {
+          worker.join();
+        }
+      });
+
+  std::cout << "# " << errors << " syntax errors, " << ll_fallbacks
+            << " LL fallbacks\n";
+}
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of an SSH tunnel when many connections transfer data at
+// the same time, like the threads of a dump or a load do. Each channel of the
+// tunnel connects to a local server, which:
+//  - download: sends the data to the channel,
+//  - upload: receives the data from the channel.
+// Since the local server listens on 127.0.0.1, the SSH server needs to run on
+// this host, and its key has to be already known (i.e. in known_hosts).
+// Empty password uses the public key authentication.
+//
+// Usage: bench_ssh_tunnel <user@host[:port]> <password> [channels]
+//                         [MB per channel] [buffer size]
+// Defaults to 8 channels, 64MB per channel and buffer size of the
+// ssh.bufferSize option.
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif  // _WIN32
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/ssh/ssh_common.h"
+#include "mysqlshdk/libs/ssh/ssh_connection_options.h"
+#include "mysqlshdk/libs/ssh/ssh_session.h"
+#include "mysqlshdk/libs/ssh/ssh_tunnel_manager.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace {
+
+using mysqlshdk::ssh::get_error;
+using mysqlshdk::ssh::ssh_close_socket;
+using mysqlshdk::ssh::Ssh_connection_options;
+using mysqlshdk::ssh::Ssh_return_type;
+using mysqlshdk::ssh::Ssh_session;
+using mysqlshdk::ssh::Ssh_tunnel_manager;
+
+constexpr std::size_t k_chunk_size = 64 * 1024;
+
+enum class Direction { DOWNLOAD, UPLOAD };
+
+sockaddr_in loopback(uint16_t port) {
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  addr.sin_port = htons(port);
+  return addr;
+}
+
+int listen_on_loopback(uint16_t *port) {
+  const int sock = socket(AF_INET, SOCK_STREAM, 0);
+  auto addr = loopback(0);
+  socklen_t len = sizeof(addr);
+
+  if (sock == -1 ||
+      bind(sock, reinterpret_cast<sockaddr *>(&addr), len) == -1 ||
+      getsockname(sock, reinterpret_cast<sockaddr *>(&addr), &len) == -1 ||
+      listen(sock, 64) == -1) {
+    throw std::runtime_error("Failed to listen: " + get_error());
+  }
+
+  *port = ntohs(addr.sin_port);
+
+  return sock;
+}
+
+int connect_to_loopback(uint16_t port) {
+  const int sock = socket(AF_INET, SOCK_STREAM, 0);
+  auto addr = loopback(port);
+
+  if (sock == -1 ||
+      connect(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == -1) {
+    throw std::runtime_error("Failed to connect: " + get_error());
+  }
+
+  return sock;
+}
+
+void send_bytes(int sock, std::size_t bytes) {
+  const std::string chunk(k_chunk_size, 'x');
+
+  while (bytes > 0) {
+    const auto sent = send(sock, chunk.data(),
+                           static_cast<int>(std::min(bytes, chunk.size())),
+                           MSG_NOSIGNAL);
+
+    if (sent <= 0) {
+      throw std::runtime_error("Failed to send: " + get_error());
+    }
+
+    bytes -= static_cast<std::size_t>(sent);
+  }
+}
+
+std::size_t receive_bytes(int sock, std::size_t bytes) {
+  std::string chunk(k_chunk_size, '\0');
+  std::size_t total = 0;
+
+  while (total < bytes) {
+    const auto received =
+        recv(sock, chunk.data(),
+             static_cast<int>(std::min(bytes - total, chunk.size())), 0);
+
+    if (received <= 0) break;
+
+    total += static_cast<std::size_t>(received);
+  }
+
+  return total;
+}
+
+/**
+ * Transfers the data through the given number of channels at the same time.
+ *
+ * @returns number of bytes transferred and transfer time of each channel
+ */
+std::vector<std::pair<std::size_t, double>> transfer(Direction direction,
+                                                     int server,
+                                                     uint16_t tunnel_port,
+                                                     std::size_t channels,
+                                                     std::size_t bytes) {
+  std::vector<std::thread> threads;
+  std::vector<std::pair<std::size_t, double>> results(channels);
+
+  for (std::size_t i = 0; i < channels; ++i) {
+    // local end of the tunnel
+    threads.emplace_back([direction, tunnel_port, bytes,
+                          &result = results[i]]() {
+      const int sock = connect_to_loopback(tunnel_port);
+      const auto t_start = std::chrono::steady_clock::now();
+
+      if (Direction::DOWNLOAD == direction) {
+        result.first = receive_bytes(sock, bytes);
+      } else {
+        send_bytes(sock, bytes);
+        // wait for the acknowledgement, data has reached the server
+        receive_bytes(sock, 1);
+        result.first = bytes;
+      }
+
+      const auto t_end = std::chrono::steady_clock::now();
+      result.second = std::max(
+          std::chrono::duration<double>(t_end - t_start).count(), 1e-9);
+
+      ssh_close_socket(sock);
+    });
+  }
+
+  // remote end of the tunnel
+  std::vector<std::thread> handlers;
+
+  for (std::size_t i = 0; i < channels; ++i) {
+    const int sock = accept(server, nullptr, nullptr);
+
+    if (sock == -1) {
+      throw std::runtime_error("Failed to accept: " + get_error());
+    }
+
+    handlers.emplace_back([direction, sock, bytes]() {
+      if (Direction::DOWNLOAD == direction) {
+        send_bytes(sock, bytes);
+      } else {
+        receive_bytes(sock, bytes);
+        send_bytes(sock, 1);
+      }
+
+      ssh_close_socket(sock);
+    });
+  }
+
+  for (auto &t : handlers) t.join();
+  for (auto &t : threads) t.join();
+
+  return results;
+}
+
+void run(const std::string &name, Direction direction, int server,
+         uint16_t tunnel_port, std::size_t channels, std::size_t bytes) {
+  const auto t_start = std::chrono::steady_clock::now();
+
+  const auto results =
+      transfer(direction, server, tunnel_port, channels, bytes);
+
+  const auto t_end = std::chrono::steady_clock::now();
+  const auto seconds =
+      std::max(std::chrono::duration<double>(t_end - t_start).count(), 1e-9);
+  constexpr double k_mb = 1024 * 1024;
+  std::size_t total = 0;
+
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const auto &[transferred, channel_seconds] = results[i];
+    total += transferred;
+
+    std::cout << "# " << name << ", channel " << i << ": " << transferred
+              << " bytes in " << channel_seconds << "s, "
+              << transferred / channel_seconds / k_mb << " MB/s"
+              << (transferred == bytes ? "" : " (size mismatch)") << "\n";
+  }
+
+  std::cout << "# " << name << ", all " << channels << " channels: " << total
+            << " bytes in " << seconds << "s, " << total / seconds / k_mb
+            << " MB/s\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0]
+              << " <user@host[:port]> <password> [channels] [MB per channel]"
+                 " [buffer size]\n";
+    return 1;
+  }
+
+  const std::size_t channels = argc > 3 ? std::stoul(argv[3]) : 8;
+  const std::size_t bytes =
+      (argc > 4 ? std::stoul(argv[4]) : 64) * 1024 * 1024;
+
+  const auto shell_options = std::make_shared<mysqlsh::Shell_options>();
+  // fail instead of prompting
+  shell_options->set_and_notify(SHCORE_USE_WIZARDS, "false");
+
+  mysqlsh::Scoped_shell_options options{shell_options};
+  mysqlsh::Scoped_logger logger{shcore::Logger::create_instance(
+      shcore::path::join_path(shcore::path::tmpdir(),
+                              "mysqlsh_bench_ssh_tunnel.log")
+          .c_str(),
+      false, shcore::Logger::LOG_WARNING)};
+
+  try {
+    uint16_t server_port = 0;
+    const int server = listen_on_loopback(&server_port);
+
+    Ssh_connection_options config{argv[1]};
+
+    if (argv[2][0]) config.set_password(argv[2]);
+    if (argc > 5) config.set_buffer_size(std::stoul(argv[5]));
+
+    config.set_remote_host("127.0.0.1");
+    config.set_remote_port(server_port);
+    config.set_default_data();
+
+    auto session = std::make_unique<Ssh_session>();
+
+    if (const auto [rc, msg] = session->connect(config);
+        Ssh_return_type::CONNECTED != rc) {
+      throw std::runtime_error("Failed to open SSH session: " + msg);
+    }
+
+    Ssh_tunnel_manager manager;
+    manager.start();
+
+    const auto tunnel_port =
+        std::get<1>(manager.create_tunnel(std::move(session)));
+
+    std::cout << "# buffer size: " << config.get_buffer_size() << " bytes\n";
+
+    run("download", Direction::DOWNLOAD, server, tunnel_port, channels, bytes);
+    run("upload", Direction::UPLOAD, server, tunnel_port, channels, bytes);
+
+    manager.set_stop();
+    manager.poke_wakeup_socket();
+    manager.join();
+
+    ssh_close_socket(server);
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures contention of the queues used to distribute tasks between threads,
+// by draining a number of trivial tasks with an increasing number of threads:
+//  - Synchronized_queue, a single queue protected with a single lock,
+//  - Work_stealing_queue, a queue for each thread, used by Thread_pool.
+//
+// Usage: bench_work_stealing_queue [tasks]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
+
+namespace {
+
+using Task = std::function<void()>;
+
+/**
+ * Pushes the given number of tasks to the queue, which is drained by the
+ * given number of consumers.
+ *
+ * @returns time it took to execute all tasks
+ */
+template <typename Queue, typename Pop>
+double drain(Queue *queue, std::size_t threads, std::size_t tasks, Pop &&pop) {
+  std::atomic<std::size_t> executed{0};
+  std::vector<std::thread> consumers;
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    consumers.emplace_back([queue, &pop, i]() {
+      while (const auto task = pop(queue, i)) {
+        task();
+      }
+    });
+  }
+
+  for (std::size_t i = 0; i < tasks; ++i) {
+    queue->push([&executed]() { ++executed; });
+  }
+
+  queue->shutdown(threads);
+
+  for (auto &consumer : consumers) {
+    consumer.join();
+  }
+
+  if (tasks != executed) {
+    std::cerr << "Expected " << tasks << " tasks to be executed, got "
+              << executed << std::endl;
+    std::exit(1);
+  }
+
+  return std::max(std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - t_start)
+                      .count(),
+                  1e-9);
+}
+
+void report(const char *name, std::size_t threads, std::size_t tasks,
+            double seconds) {
+  std::cout << "# " << name << ", " << threads << " thread"
+            << (threads > 1 ? "s" : "") << ": " << tasks << " tasks in "
+            << seconds << "s, " << tasks / seconds << " tasks/s\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  const std::size_t tasks = argc > 1 ? std::stoul(argv[1]) : 200000;
+
+  for (const std::size_t threads : {1, 2, 4, 8, 16, 32, 64, 128}) {
+    {
+      shcore::Synchronized_queue<Task> queue;
+
+      report("Synchronized_queue", threads, tasks,
+             drain(&queue, threads, tasks,
+                   [](auto q, std::size_t) { return q->pop(); }));
+    }
+
+    {
+      shcore::Work_stealing_queue<Task> queue{threads};
+
+      report("Work_stealing_queue", threads, tasks,
+             drain(&queue, threads, tasks,
+                   [](auto q, std::size_t id) { return q->pop(id); }));
+    }
+  }
+
+  return 0;
+}
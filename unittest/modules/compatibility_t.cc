@@ -1023,6 +1023,79 @@ TEST_F(Compatibility_test, create_table_combo) {
   EXPECT_UNCHANGED(1);
 }
 
+TEST_F(Compatibility_test, create_table_option_filter) {
+  std::vector<std::string> statements(multiline.begin(), multiline.end() - 1);
+  statements.insert(statements.end(), rogue.begin(), rogue.end() - 1);
+
+  statements.emplace_back(
+      "CREATE TABLE t (a int) ENGINE=MyISAM ROW_FORMAT=FIXED, "
+      "DATA DIRECTORY='/tmp' TABLESPACE ts STORAGE DISK, ENCRYPTION='Y'");
+  statements.emplace_back(
+      "CREATE TABLE t (a int) ROW_FORMAT=FIXED,DATA DIRECTORY='/tmp',"
+      "COMMENT='x'");
+  statements.emplace_back(
+      "CREATE TABLE t (a int) COMMENT='engine=x' /*!50100 TABLESPACE `ts` */ "
+      "ENGINE = `MyISAM`, ROW_FORMAT FIXED");
+  statements.emplace_back(
+      "CREATE TABLE t (a int) TABLESPACE innodb_system ENGINE=MEMORY "
+      "INDEX DIRECTORY \"/tmp\"");
+
+  Create_table_option_filter filter;
+
+  for (const auto &statement : statements) {
+    for (const bool mysqlaas : {false, true}) {
+      for (const bool force_innodb : {false, true}) {
+        for (const bool strip_tablespaces : {false, true}) {
+          SCOPED_TRACE(statement + " - " + std::to_string(mysqlaas) +
+                       std::to_string(force_innodb) +
+                       std::to_string(strip_tablespaces));
+
+          // same sequence as in Schema_dumper::check_ct_for_mysqlaas()
+          auto expected = statement;
+          filter.reset(statement);
+
+          if (mysqlaas) {
+            EXPECT_EQ(check_create_table_for_data_index_dir_option(expected,
+                                                                   &expected),
+                      filter.data_index_dir_option(true));
+            EXPECT_EQ(
+                check_create_table_for_encryption_option(expected, &expected),
+                filter.encryption_option(true));
+          }
+
+          if (mysqlaas || force_innodb) {
+            const auto engine = check_create_table_for_engine_option(
+                expected, force_innodb ? &expected : nullptr);
+            EXPECT_EQ(engine, filter.engine_option(force_innodb));
+
+            const auto fix = force_innodb || engine.empty();
+            EXPECT_EQ(check_create_table_for_fixed_row_format(
+                          expected, fix ? &expected : nullptr),
+                      filter.fixed_row_format(fix));
+          }
+
+          if (mysqlaas || strip_tablespaces) {
+            EXPECT_EQ(check_create_table_for_tablespace_option(
+                          expected, strip_tablespaces ? &expected : nullptr),
+                      filter.tablespace_option(strip_tablespaces));
+          }
+
+          EXPECT_EQ(expected, filter.statement());
+        }
+      }
+    }
+  }
+
+  // malformed statements
+  filter.reset("CREATE TABLE t");
+  EXPECT_THROW_LIKE(filter.engine_option(true), std::runtime_error,
+                    "columns definition not found");
+
+  filter.reset("CREATE VIEW v AS SELECT 1");
+  EXPECT_THROW_LIKE(filter.fixed_row_format(true), std::runtime_error,
+                    "Malformed create table statement");
+}
+
 TEST_F(Compatibility_test, check_create_table_for_indexes) {
   const auto EXPECT_STMTS = [](const std::string &sql, const std::string &table,
                                bool fulltext_only,
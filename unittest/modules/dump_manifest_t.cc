@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/dump/dump_manifest.h"
+
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+using mysqlshdk::storage::Compression;
+
+class Dump_manifest_test : public ::testing::TestWithParam<Compression> {
+ protected:
+  void SetUp() override {
+    m_path = shcore::path::join_path(shcore::path::tmpdir(),
+                                     std::string{k_dump_manifest_file});
+  }
+
+  void TearDown() override { shcore::delete_file(m_path); }
+
+  std::string m_path;
+};
+
+std::unordered_set<mysqlshdk::storage::IDirectory::File_info> files(
+    const std::vector<std::pair<std::string, std::string>> &contents) {
+  std::unordered_set<mysqlshdk::storage::IDirectory::File_info> result;
+
+  for (const auto &file : contents) {
+    mysqlshdk::storage::IDirectory::File_info info{file.first,
+                                                   file.second.size()};
+    info.set_version("v-" + file.first);
+    result.emplace(std::move(info));
+  }
+
+  return result;
+}
+
+TEST_P(Dump_manifest_test, round_trip) {
+  const std::string large(100000, 'x');
+  const std::vector<std::pair<std::string, std::string>> contents = {
+      {"@.json", R"({"version":"2.0.1"})"},
+      {"sakila.json", "{}"},
+      {"sakila@actor.sql", "CREATE TABLE actor (id int);"},
+      {"empty.sql", ""},
+      {"large.sql", large},
+  };
+
+  {
+    Dump_manifest_writer writer{GetParam()};
+
+    for (const auto &file : contents) {
+      writer.add(file.first, file.second);
+    }
+
+    // not in the list of files, skipped
+    writer.add("missing.sql", "CREATE TABLE missing (id int);");
+
+    writer.write(files(contents), mysqlshdk::storage::make_file(m_path));
+  }
+
+  auto file = mysqlshdk::storage::make_file(m_path);
+  Dump_manifest_reader reader{file.get()};
+
+  EXPECT_EQ(5, reader.size());
+  EXPECT_EQ(R"({"version":"2.0.1"})", reader.fetch("@.json"));
+  EXPECT_EQ("{}", reader.fetch("sakila.json"));
+  EXPECT_EQ("CREATE TABLE actor (id int);", reader.fetch("sakila@actor.sql"));
+  EXPECT_EQ("", reader.fetch("empty.sql"));
+  EXPECT_EQ(large, reader.fetch("large.sql"));
+  EXPECT_FALSE(reader.fetch("sakila@film.sql").has_value());
+  EXPECT_FALSE(reader.fetch("missing.sql").has_value());
+
+  // versions of the files are stored
+  reader.remove_if(
+      [](const std::string &name, uint64_t, const std::string &version) {
+        return "v-" + name != version;
+      });
+  EXPECT_EQ(5, reader.size());
+
+  // drop entries which do not match the size of the files
+  reader.remove_if([](const std::string &name, uint64_t size,
+                      const std::string &) {
+    return "sakila.json" == name && 2 != size;
+  });
+  EXPECT_EQ(5, reader.size());
+
+  reader.remove_if([](const std::string &name, uint64_t size,
+                      const std::string &) {
+    return "sakila@actor.sql" == name && 10 != size;
+  });
+  EXPECT_EQ(4, reader.size());
+  EXPECT_FALSE(reader.fetch("sakila@actor.sql").has_value());
+  EXPECT_EQ("{}", reader.fetch("sakila.json"));
+}
+
+INSTANTIATE_TEST_SUITE_P(Dump_manifest, Dump_manifest_test,
+                         ::testing::Values(Compression::NONE,
+                                           Compression::GZIP,
+                                           Compression::ZSTD,
+                                           Compression::LZ4));
+
+TEST_F(Dump_manifest_test, malformed) {
+  const auto expect_malformed = [this](const std::string &contents) {
+    SCOPED_TRACE(contents);
+    shcore::create_file(m_path, contents);
+
+    auto file = mysqlshdk::storage::make_file(m_path);
+    EXPECT_THROW(Dump_manifest_reader{file.get()}, std::runtime_error);
+  };
+
+  expect_malformed("");
+  expect_malformed("not a manifest");
+  // valid magic, index points outside of the file
+  expect_malformed(std::string(16, '\xFF') + "MSHDMNF1");
+  // valid location, invalid index
+  expect_malformed(std::string{"{"} + std::string(8, '\0') + '\x01' +
+                   std::string(7, '\0') + "MSHDMNF1");
+}
+
+TEST_F(Dump_manifest_test, checksum) {
+  const std::string ddl = "CREATE TABLE actor (id int);";
+
+  {
+    Dump_manifest_writer writer{Compression::NONE};
+    writer.add("sakila@actor.sql", ddl);
+    writer.write(files({{"sakila@actor.sql", ddl}}),
+                 mysqlshdk::storage::make_file(m_path));
+  }
+
+  {
+    auto file = mysqlshdk::storage::make_file(m_path);
+    Dump_manifest_reader reader{file.get()};
+    EXPECT_EQ(ddl, reader.fetch("sakila@actor.sql"));
+  }
+
+  // modify the contents of the entry, without changing its size
+  auto contents = shcore::get_text_file(m_path);
+  ASSERT_EQ(0, contents.find(ddl));
+  contents[0] = 'c';
+  shcore::create_file(m_path, contents);
+
+  auto file = mysqlshdk::storage::make_file(m_path);
+  Dump_manifest_reader reader{file.get()};
+  EXPECT_EQ(1, reader.size());
+  EXPECT_FALSE(reader.fetch("sakila@actor.sql").has_value());
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
@@ -380,4 +380,75 @@ TEST_F(Dump_scheduler, load_scheduler) {
     test_scheduling(Dump_reader::schedule_chunk_proportionally, tables, 16);
   }
 }
+
+TEST_F(Dump_scheduler, largest_tables_first) {
+  auto small = make_table("small", 10, 20, 1);
+  auto large = make_table("large", 5, 20, 1);
+
+  small.data_info.back().owner = &small;
+  large.data_info.back().owner = &large;
+
+  std::unordered_multimap<std::string, size_t> tables_being_loaded;
+  std::unordered_set<Dump_reader::Table_data_info *> tables_with_data{
+      &small.data_info.back(), &large.data_info.back()};
+
+  // without metadata, table with more data available is scheduled first
+  EXPECT_EQ(&small.data_info.back(),
+            *Dump_reader::schedule_chunk_proportionally(
+                tables_being_loaded, &tables_with_data, 2));
+
+  // with metadata, table with more data remaining is scheduled first
+  small.data_info.back().data_size = 200;
+  large.data_info.back().data_size = 10000;
+
+  EXPECT_EQ(&large.data_info.back(),
+            *Dump_reader::schedule_chunk_proportionally(
+                tables_being_loaded, &tables_with_data, 2));
+
+  // both tables are being loaded, data remaining in the large table is used
+  // to determine its share of threads
+  small.data_info.back().consume_chunk();
+  large.data_info.back().consume_chunk();
+  tables_being_loaded.emplace(small.data_info.back().key(), 20);
+  tables_being_loaded.emplace(large.data_info.back().key(), 20);
+
+  EXPECT_EQ(&large.data_info.back(),
+            *Dump_reader::schedule_chunk_proportionally(
+                tables_being_loaded, &tables_with_data, 2));
+}
+
+TEST_F(Dump_scheduler, chunk_data_sizes) {
+  auto front = make_table("front", 4, 20, 1);
+  auto back = make_table("back", 4, 20, 1);
+  auto &front_data = front.data_info.back();
+  auto &back_data = back.data_info.back();
+
+  front_data.owner = &front;
+  back_data.owner = &back;
+  front_data.data_size = 4000;
+  back_data.data_size = 4000;
+
+  std::unordered_multimap<std::string, size_t> tables_being_loaded;
+  std::unordered_set<Dump_reader::Table_data_info *> tables_with_data{
+      &front_data, &back_data};
+
+  front_data.consume_chunk();
+  back_data.consume_chunk();
+  tables_being_loaded.emplace(front_data.key(), 100);
+  tables_being_loaded.emplace(back_data.key(), 100);
+
+  // without sizes of chunks, data is assumed to be distributed evenly
+  EXPECT_EQ(3000u, front_data.bytes_remaining());
+  EXPECT_EQ(3000u, back_data.bytes_remaining());
+
+  // with sizes of chunks, exact amount of the remaining data is used
+  front_data.chunk_data_sizes = {3700, 100, 100, 100};
+  back_data.chunk_data_sizes = {100, 100, 100, 3700};
+
+  EXPECT_EQ(300u, front_data.bytes_remaining());
+  EXPECT_EQ(3900u, back_data.bytes_remaining());
+
+  EXPECT_EQ(&back_data, *Dump_reader::schedule_chunk_proportionally(
+                            tables_being_loaded, &tables_with_data, 2));
+}
 }  // namespace mysqlsh
@@ -28,6 +28,7 @@
 #include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/compatibility.h"
 #include "modules/util/dump/schema_dumper.h"
+#include "modules/util/load/adaptive_threads.h"
 #include "modules/util/load/dump_loader.h"
 #include "modules/util/load/dump_reader.h"
 #include "modules/util/load/load_dump_options.h"
@@ -50,6 +51,7 @@ using ::testing::Exactly;
 using ::testing::Return;
 using ::testing::ReturnRef;
 using ::testing::StrEq;
+using ::testing::Throw;
 
 using mysqlshdk::utils::Version;
 
@@ -231,6 +233,158 @@ shcore::Interpreter_print_handler g_silencer(
     [](void *, const char *) { return true; },
     [](void *, const char *) { return true; });
 
+TEST(Load_dump, adaptive_threads) {
+  Adaptive_threads threads{2, 8};
+
+  const auto EXPECT_HOLD = [&threads](uint64_t throughput) {
+    const auto expected = threads.threads();
+
+    for (uint32_t i = 0; i < Adaptive_threads::k_hold_samples; ++i) {
+      EXPECT_FALSE(threads.sample(throughput, ""));
+      EXPECT_EQ(expected, threads.threads());
+    }
+  };
+
+  // starts with the maximum number of threads, which cannot be exceeded
+  EXPECT_EQ(8, threads.threads());
+  EXPECT_FALSE(threads.sample(1000, ""));
+  EXPECT_EQ(8, threads.threads());
+
+  // server is under pressure, a quarter of threads is removed
+  EXPECT_TRUE(threads.sample(1000, "pressure"));
+  EXPECT_EQ(6, threads.threads());
+
+  // number of threads does not change for a while, then a thread is added
+  EXPECT_HOLD(1000);
+  EXPECT_TRUE(threads.sample(1000, ""));
+  EXPECT_EQ(7, threads.threads());
+
+  // throughput decreased after a thread was added, thread is removed
+  EXPECT_TRUE(threads.sample(900, ""));
+  EXPECT_EQ(6, threads.threads());
+
+  // threads are added while throughput does not decrease by more than 5%
+  EXPECT_HOLD(900);
+  EXPECT_TRUE(threads.sample(900, ""));
+  EXPECT_EQ(7, threads.threads());
+  EXPECT_TRUE(threads.sample(860, ""));
+  EXPECT_EQ(8, threads.threads());
+  EXPECT_FALSE(threads.sample(1000, ""));
+  EXPECT_EQ(8, threads.threads());
+
+  // threads are not removed if throughput decreases without a thread added
+  EXPECT_FALSE(threads.sample(500, ""));
+  EXPECT_EQ(8, threads.threads());
+
+  // pressure reduces the number of threads down to the minimum
+  for (const uint64_t expected : {6, 5, 4, 3, 2}) {
+    EXPECT_TRUE(threads.sample(500, "pressure"));
+    EXPECT_EQ(expected, threads.threads());
+  }
+
+  EXPECT_FALSE(threads.sample(500, "pressure"));
+  EXPECT_EQ(2, threads.threads());
+
+  // throughput is not compared with a sample taken when data was not loaded
+  EXPECT_HOLD(500);
+  EXPECT_TRUE(threads.sample(500, ""));
+  EXPECT_EQ(3, threads.threads());
+  threads.idle();
+  EXPECT_TRUE(threads.sample(100, ""));
+  EXPECT_EQ(4, threads.threads());
+
+  // minimum cannot exceed the maximum
+  Adaptive_threads fixed{4, 2};
+  EXPECT_EQ(2, fixed.threads());
+  EXPECT_FALSE(fixed.sample(100, "pressure"));
+  EXPECT_EQ(2, fixed.threads());
+  EXPECT_FALSE(fixed.sample(100, ""));
+  EXPECT_EQ(2, fixed.threads());
+}
+
+TEST(Load_dump, add_index_budget) {
+  const auto mock = std::make_shared<testing::Mock_mysql_session>();
+  const std::string reset =
+      "SET SESSION innodb_parallel_read_threads = DEFAULT, "
+      "innodb_ddl_threads = DEFAULT, innodb_ddl_buffer_size = DEFAULT";
+
+  const auto EXPECT_BUDGET = [&mock](uint64_t read_threads,
+                                     uint64_t ddl_threads,
+                                     uint64_t buffer_size) {
+    const auto query = shcore::sqlformat(
+        "SET SESSION innodb_parallel_read_threads = ?, innodb_ddl_threads = ?, "
+        "innodb_ddl_buffer_size = ?",
+        read_threads, ddl_threads, buffer_size);
+    EXPECT_CALL(*mock, executes(StrEq(query.c_str()), _)).Times(Exactly(1));
+  };
+
+  Load_dump_options::Add_index_limits limits;
+  limits.parallel_read_threads = 4;
+  limits.ddl_threads = 4;
+  limits.ddl_buffer_size = 4 * 1024 * 1024;
+
+  {
+    SCOPED_TRACE("budget capped by the limits");
+    EXPECT_BUDGET(4, 4, 4 * 1024 * 1024);
+    EXPECT_TRUE(Dump_loader::set_add_index_budget(mock, limits, 8));
+    testing::Mock::VerifyAndClearExpectations(mock.get());
+  }
+
+  {
+    SCOPED_TRACE("buffer is shared between the threads");
+    EXPECT_BUDGET(2, 2, 2 * 1024 * 1024);
+    EXPECT_TRUE(Dump_loader::set_add_index_budget(mock, limits, 2));
+    testing::Mock::VerifyAndClearExpectations(mock.get());
+  }
+
+  {
+    SCOPED_TRACE("buffer does not go below the minimum size");
+    limits.ddl_buffer_size = 4 * 1024;
+    EXPECT_BUDGET(1, 1, 64 * 1024);
+    EXPECT_TRUE(Dump_loader::set_add_index_budget(mock, limits, 1));
+    testing::Mock::VerifyAndClearExpectations(mock.get());
+  }
+
+  {
+    SCOPED_TRACE("budget is not set if there are no limits");
+    limits.ddl_threads = 0;
+    EXPECT_CALL(*mock, executes(_, _)).Times(Exactly(0));
+    EXPECT_FALSE(Dump_loader::set_add_index_budget(mock, limits, 4));
+    testing::Mock::VerifyAndClearExpectations(mock.get());
+    limits.ddl_threads = 4;
+  }
+
+  {
+    SCOPED_TRACE("failure to set the budget is not fatal");
+    EXPECT_CALL(*mock, executes(_, _))
+        .WillOnce(Throw(mysqlshdk::db::Error("Access denied", 1227)));
+    EXPECT_FALSE(Dump_loader::set_add_index_budget(mock, limits, 4));
+    testing::Mock::VerifyAndClearExpectations(mock.get());
+  }
+
+  {
+    SCOPED_TRACE("budget is reset when leaving the scope");
+    EXPECT_CALL(*mock, executes(StrEq(reset.c_str()), _)).Times(Exactly(1));
+
+    try {
+      shcore::on_leave_scope reset_budget{
+          [&mock]() { Dump_loader::reset_add_index_budget(mock); }};
+      throw std::runtime_error("ALTER TABLE failed");
+    } catch (const std::runtime_error &) {
+    }
+
+    testing::Mock::VerifyAndClearExpectations(mock.get());
+  }
+
+  {
+    SCOPED_TRACE("failure to reset the budget does not throw");
+    EXPECT_CALL(*mock, executes(StrEq(reset.c_str()), _))
+        .WillOnce(Throw(mysqlshdk::db::Error("Lost connection", 2013)));
+    EXPECT_NO_THROW(Dump_loader::reset_add_index_budget(mock));
+    testing::Mock::VerifyAndClearExpectations(mock.get());
+  }
+}
+
 namespace {
 #include "unittest/data/load/test_dump1.h"
 
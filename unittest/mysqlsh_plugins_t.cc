@@ -31,6 +31,7 @@
 #include "unittest/test_utils/mocks/gmock_clean.h"
 
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/process_launcher.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
@@ -1873,4 +1874,91 @@ shell.registerGlobal('gl', gl);
   delete_user_plugin("bug31693096");
 }
 
+TEST_F(Mysqlsh_plugin_test, lazy_init) {
+  // plugin adds a function to a built-in object and a new global object
+  write_user_plugin("lazy-init", R"(print('lazy-init plugin loaded')
+
+def echo(text):
+  print('lazy-init echo: ' + text)
+
+definition = {
+  'brief': 'Prints the given text.',
+  'cli': True,
+  'parameters': [{'name': 'text', 'type': 'string', 'brief': 'Text.'}]
+}
+
+shell.add_extension_object_member(util, 'lazyInitEcho', echo, definition)
+
+obj = shell.create_extension_object()
+shell.add_extension_object_member(obj, 'echo', echo, definition)
+shell.register_global('lazyInit', obj, {'brief': 'Lazy init tester.'})
+)",
+                    ".py");
+
+  // built-in operation of a built-in object, plugins are not loaded
+  run_cli_plugin(
+      {"--lazy-init", "--", "util", "check-for-server-upgrade", "--help"});
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("check-for-server-upgrade");
+  MY_EXPECT_CMD_OUTPUT_NOT_CONTAINS("lazy-init plugin loaded");
+  wipe_out();
+
+  // same call, without lazy initialization
+  run_cli_plugin({"--", "util", "check-for-server-upgrade", "--help"});
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("check-for-server-upgrade");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("lazy-init plugin loaded");
+  wipe_out();
+
+  // operation added by a plugin to a built-in object
+  run_cli_plugin({"--lazy-init", "--", "util", "lazy-init-echo", "one"});
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("lazy-init plugin loaded");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("lazy-init echo: one");
+  wipe_out();
+
+  // operation of a plugin object
+  run_cli_plugin({"--lazy-init", "--", "lazyInit", "echo", "two"});
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("lazy-init plugin loaded");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("lazy-init echo: two");
+  wipe_out();
+
+  delete_user_plugin("lazy-init");
+}
+
+TEST_F(Mysqlsh_plugin_test, startup_profile) {
+  const std::vector<std::string> args = {
+      "--startup-profile", "--", "util", "check-for-server-upgrade", "--help"};
+
+  // stdout and stderr
+  run_cli_plugin(args);
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("check-for-server-upgrade");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("Startup profile:");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("plugins");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("total");
+  wipe_out();
+
+  // stdout only, profile is printed to stderr
+  std::vector<const char *> argv = {_mysqlsh};
+
+  for (const auto &arg : args) {
+    argv.emplace_back(arg.c_str());
+  }
+
+  argv.emplace_back(nullptr);
+
+  shcore::Process_launcher process{&argv[0], false};
+  process.set_environment({std::string{"MYSQLSH_USER_CONFIG_HOME="} +
+                           shcore::get_user_config_path()});
+  process.start();
+
+  std::string output;
+  char c;
+
+  while (process.read(&c, 1) > 0) {
+    output += c;
+  }
+
+  EXPECT_EQ(0, process.wait());
+  EXPECT_NE(std::string::npos, output.find("check-for-server-upgrade"));
+  EXPECT_EQ(std::string::npos, output.find("Startup profile:"));
+}
+
 }  // namespace tests
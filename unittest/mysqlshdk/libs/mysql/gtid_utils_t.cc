@@ -25,6 +25,9 @@
 
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 
+#include <random>
+#include <string>
+
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_mysql_session.h"
@@ -748,5 +751,72 @@ TEST_F(Gtid_utils, subtract_view_changes_tag_support) {
               .str());
 }
 
+TEST_F(Gtid_utils, gtid_set_ops_match_server) {
+  auto session = db::mysql::Session::create();
+  session->connect(db::Connection_options(_mysql_uri));
+  mysqlshdk::mysql::Instance server(session);
+
+  const bool tags = server.get_version() >= mysqlshdk::utils::Version(8, 3, 0);
+  const char *uuids[] = {"8b8dc2ba-8803-11eb-af3d-a1178d81dccc",
+                         "88888888-8803-11EB-AF3D-A1178D81DCCC",
+                         "9b8dc2ba-0000-11eb-af3d-a1178d81dccc"};
+  const char *tag_names[] = {"foo", "BAR", "_x"};
+
+  std::mt19937 gen(2024);
+  const auto random = [&gen](uint64_t max) { return gen() % max; };
+
+  const auto random_set = [&]() {
+    std::string gtid_set;
+
+    for (auto i = random(4); i > 0; --i) {
+      if (!gtid_set.empty()) gtid_set += random(2) ? ",\n" : ",";
+
+      gtid_set += uuids[random(std::size(uuids))];
+
+      for (auto j = 1 + random(5); j > 0; --j) {
+        if (tags && !random(3)) {
+          gtid_set.append(":").append(tag_names[random(std::size(tag_names))]);
+        }
+
+        const auto begin = 1 + random(50);
+        const auto end = begin + random(2) * random(10);
+
+        gtid_set.append(":").append(std::to_string(begin));
+
+        if (begin != end) gtid_set.append("-").append(std::to_string(end));
+      }
+    }
+
+    return gtid_set;
+  };
+
+  for (int i = 0; i < 200; ++i) {
+    const auto a = random_set();
+    const auto b = random_set();
+    SCOPED_TRACE("a: " + a + ", b: " + b);
+
+    EXPECT_EQ(server.queryf_one_string(0, "", "SELECT gtid_subtract(?, '')", a),
+              Gtid_set::from_string(a).normalize(server).str());
+
+    EXPECT_EQ(
+        server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)", a, b),
+        Gtid_set::from_string(a).subtract(Gtid_set::from_string(b), server)
+            .str());
+
+    if (!a.empty() && !b.empty()) {
+      EXPECT_EQ(server.queryf_one_string(
+                    0, "", "SELECT gtid_subtract(?, gtid_subtract(?, ?))", a,
+                    a, b),
+                Gtid_set::from_string(a)
+                    .intersect(Gtid_set::from_string(b), server)
+                    .str());
+    }
+
+    EXPECT_EQ(
+        server.queryf_one_int(0, 0, "SELECT gtid_subset(?, ?)", b, a) != 0,
+        Gtid_set::from_string(a).contains(Gtid_set::from_string(b), server));
+  }
+}
+
 }  // namespace mysql
 }  // namespace mysqlshdk
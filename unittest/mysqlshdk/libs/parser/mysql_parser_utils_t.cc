@@ -143,5 +143,36 @@ DELIMITER ;
                Sql_syntax_error);
 }
 
+TEST(MysqlParserUtils, syntax_checker_reuse) {
+  Sql_syntax_checker checker;
+
+  EXPECT_NO_THROW(checker.check("select 1"));
+  EXPECT_NO_THROW(checker.check("select 1; select 2"));
+
+  try {
+    checker.check(R"*(
+DELIMITER $$
+select 1$$
+CREATE PROCEDURE p()
+BEGIN
+  DECLARE rows INT DEFAULT 0;
+END$$
+)*");
+    ADD_FAILURE() << "Syntax error was not reported";
+  } catch (const Sql_syntax_error &e) {
+    // error is reported by the LL pass
+    EXPECT_EQ("rows", e.token_text());
+  }
+
+  EXPECT_LE(1, checker.ll_fallbacks());
+
+  // checker is still usable after an error was reported
+  const auto fallbacks = checker.ll_fallbacks();
+  EXPECT_NO_THROW(checker.check("select `rows` from t"));
+  EXPECT_EQ(fallbacks, checker.ll_fallbacks());
+
+  EXPECT_THROW(checker.check("select rows from t"), Sql_syntax_error);
+}
+
 }  // namespace parser
 }  // namespace mysqlshdk
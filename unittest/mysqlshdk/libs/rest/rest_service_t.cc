@@ -46,6 +46,7 @@ extern char **environ;
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 extern "C" const char *g_test_home;
 
@@ -858,6 +859,148 @@ TEST_F(Rest_service_test, bug34765385) {
   EXPECT_GE(d.seconds_elapsed(), 2.0);  // two retries, one second each
 }
 
+TEST_F(Rest_service_test, shared_connections) {
+  FAIL_IF_NO_SERVER
+
+  Rest_service other{s_test_server->get_address(), false};
+
+  {
+    // make sure there's an open connection
+    auto request = Request("/get");
+    EXPECT_EQ(Response::Status_code::OK, m_service.get(&request).status);
+  }
+
+  const auto before = transport_stats();
+
+  {
+    // connection opened by the first service is reused by the second one
+    auto request = Request("/get");
+    EXPECT_EQ(Response::Status_code::OK, other.get(&request).status);
+  }
+
+  const auto after = transport_stats();
+
+  EXPECT_EQ(before.requests + 1, after.requests);
+  EXPECT_EQ(before.connections, after.connections);
+  EXPECT_LT(0.0, after.reuse_rate());
+}
+
+TEST_F(Rest_service_test, release_transport) {
+  FAIL_IF_NO_SERVER
+
+  Rest_service other{s_test_server->get_address(), false};
+
+  {
+    auto request = Request("/get");
+    EXPECT_EQ(Response::Status_code::OK, other.get(&request).status);
+  }
+
+  release_transport();
+
+  {
+    // existing service keeps the transport it was using
+    auto request = Request("/get");
+    EXPECT_EQ(Response::Status_code::OK, other.get(&request).status);
+  }
+
+  {
+    // new service uses a new transport
+    Rest_service service{s_test_server->get_address(), false};
+    auto request = Request("/get");
+    EXPECT_EQ(Response::Status_code::OK, service.get(&request).status);
+  }
+}
+
+TEST_F(Rest_service_test, max_connections) {
+  FAIL_IF_NO_SERVER
+
+  const auto options = transport_options();
+  shcore::on_leave_scope restore_options{
+      [&options]() { set_transport_options(options); }};
+
+  auto limited = options;
+  limited.max_connections = 1;
+  set_transport_options(limited);
+
+  // services use different hosts, each one needs its own connection
+  const auto localhost = shcore::str_replace(s_test_server->get_address(),
+                                             "127.0.0.1", "localhost");
+  Rest_service first{s_test_server->get_address(), false};
+  Rest_service second{localhost, false};
+
+  const auto get = [](Rest_service *service) {
+    auto request = Request("/get");
+    EXPECT_EQ(Response::Status_code::OK, service->get(&request).status);
+  };
+
+  get(&first);
+  get(&second);
+
+  const auto before = transport_stats();
+
+  // only one connection is kept alive, the other one has to be reopened
+  get(&first);
+  get(&second);
+
+  const auto stats = transport_stats() - before;
+
+  EXPECT_EQ(2u, stats.requests);
+  EXPECT_EQ(2u, stats.connections);
+}
+
+TEST_F(Rest_service_test, http2) {
+  FAIL_IF_NO_SERVER
+
+  const auto options = transport_options();
+  shcore::on_leave_scope restore_options{
+      [&options]() { set_transport_options(options); }};
+
+  auto http2 = options;
+  http2.http2 = true;
+  set_transport_options(http2);
+
+  // test server supports only HTTP/1.1, request succeeds after falling back
+  Rest_service service{s_test_server->get_address(), false};
+  auto request = Request("/get");
+  EXPECT_EQ(Response::Status_code::OK, service.get(&request).status);
+}
+
+TEST(Rest_service, transport_options) {
+  const auto options = transport_options();
+  shcore::on_leave_scope restore_options{
+      [&options]() { set_transport_options(options); }};
+
+  EXPECT_EQ(8, options.max_connections);
+  EXPECT_FALSE(options.http2);
+
+  set_transport_options({16, true});
+
+  EXPECT_EQ(16, transport_options().max_connections);
+  EXPECT_TRUE(transport_options().http2);
+}
+
+TEST(Rest_service, transport_stats) {
+  Transport_stats stats;
+  EXPECT_EQ(0.0, stats.reuse_rate());
+
+  stats.requests = 4;
+  stats.connections = 1;
+  EXPECT_EQ(0.75, stats.reuse_rate());
+  EXPECT_EQ("4 requests, 1 new connections, 75.0% of connections reused",
+            stats.to_string());
+
+  stats.connections = 5;
+  EXPECT_EQ(0.0, stats.reuse_rate());
+
+  Transport_stats start;
+  start.requests = 1;
+  start.connections = 1;
+
+  const auto diff = stats - start;
+  EXPECT_EQ(3u, diff.requests);
+  EXPECT_EQ(4u, diff.connections);
+}
+
 }  // namespace test
 }  // namespace rest
 }  // namespace mysqlshdk
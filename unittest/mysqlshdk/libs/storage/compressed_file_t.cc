@@ -27,11 +27,14 @@
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/shell_test_env.h"
 
+#include <chrono>
+#include <iostream>
 #include <memory>
 #include <random>
 #include <utility>
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/read_ahead_file.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 
 namespace mysqlshdk {
@@ -145,6 +148,26 @@ std::string Generate_text::bytes(size_t length) {
   return s;
 }
 
+std::string compress(const std::string &data,
+                     mysqlshdk::storage::Compression ctype) {
+  auto memory = std::make_unique<backend::Memory_file>("");
+  const auto output = memory.get();
+  const auto file = mysqlshdk::storage::make_file(std::move(memory), ctype);
+
+  file->open(Mode::WRITE);
+  file->write(data.data(), data.size());
+  file->close();
+
+  return output->content();
+}
+
+std::unique_ptr<IFile> compressed_file(const std::string &data,
+                                       mysqlshdk::storage::Compression ctype) {
+  auto memory = std::make_unique<backend::Memory_file>("");
+  memory->set_content(compress(data, ctype));
+  return mysqlshdk::storage::make_file(std::move(memory), ctype);
+}
+
 }  // namespace
 
 class Compression
@@ -251,6 +274,14 @@ class Compression
         EXPECT_EQ(static_cast<std::string::value_type>(0xfd), header[3]);
         break;
 
+      case mysqlshdk::storage::Compression::LZ4:
+        // is lz4? (lz4 frame header startswith "\x04\x22\x4d\x18")
+        EXPECT_EQ(static_cast<std::string::value_type>(0x04), header[0]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x22), header[1]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x4d), header[2]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x18), header[3]);
+        break;
+
       case mysqlshdk::storage::Compression::NONE:
         break;
     }
@@ -326,6 +357,111 @@ TEST_P(Compression, options_level) {
   }
 }
 
+TEST_P(Compression, concatenated_streams) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+
+  Generate_text g;
+  const auto first = g.bytes(300 * 1024);
+  const auto second = g.bytes(1024);
+  const auto third = g.bytes(2 * 1024 * 1024);
+  const auto ctype = std::get<0>(GetParam());
+
+  auto memory = std::make_unique<Memory_file>("");
+  memory->set_content(compress(first, ctype) + compress(std::string{}, ctype) +
+                      compress(second, ctype) + compress(third, ctype));
+  const auto file = mysqlshdk::storage::make_file(std::move(memory), ctype);
+
+  byte buffer[BUFSIZE];
+  std::string result;
+
+  file->open(Mode::READ);
+
+  for (auto read_bytes = file->read(buffer, BUFSIZE); read_bytes > 0;
+       read_bytes = file->read(buffer, BUFSIZE)) {
+    result.append(buffer, read_bytes);
+  }
+
+  file->close();
+
+  EXPECT_EQ(first + second + third, result);
+}
+
+TEST_P(Compression, read_ahead) {
+  using compression::Read_ahead_file;
+
+  Generate_text g;
+  const auto ctype = std::get<0>(GetParam());
+
+  for (const std::size_t length : {0, 1, 1024, 65536, 65537, 1024 * 1024}) {
+    for (const std::size_t max_blocks : {1, 2, 4}) {
+      SCOPED_TRACE("length: " + std::to_string(length) +
+                   ", blocks: " + std::to_string(max_blocks));
+
+      const auto data = g.bytes(length).substr(0, length);
+      Read_ahead_file file{compressed_file(data, ctype), 64 * 1024, max_blocks};
+      byte buffer[10000];
+      std::string result;
+      std::size_t file_bytes = 0;
+
+      file.open(Mode::READ);
+
+      for (auto read_bytes = file.read(buffer, sizeof(buffer)); read_bytes > 0;
+           read_bytes = file.read(buffer, sizeof(buffer))) {
+        result.append(buffer, read_bytes);
+        file_bytes += file.latest_io_size();
+      }
+
+      file_bytes += file.latest_io_size();
+      EXPECT_EQ(static_cast<off64_t>(data.size()), file.tell());
+
+      file.close();
+
+      EXPECT_EQ(data, result);
+      // all compressed bytes are reported
+      EXPECT_EQ(compress(data, ctype).size(), file_bytes);
+    }
+  }
+
+  // file can be reopened, and closed before all data is read
+  {
+    const auto data = g.bytes(1024 * 1024);
+    Read_ahead_file file{compressed_file(data, ctype), 1024};
+    byte buffer[100];
+
+    for (int i = 0; i < 2; ++i) {
+      file.open(Mode::READ);
+      EXPECT_EQ(static_cast<ssize_t>(sizeof(buffer)),
+                file.read(buffer, sizeof(buffer)));
+      EXPECT_EQ(data.substr(0, sizeof(buffer)),
+                std::string(buffer, sizeof(buffer)));
+      file.close();
+    }
+  }
+
+  // errors are reported by the reader
+  {
+    auto memory = std::make_unique<backend::Memory_file>("");
+    memory->set_content(std::string(1000, 'x'));
+    Read_ahead_file file{
+        mysqlshdk::storage::make_file(std::move(memory), ctype), 1024};
+    byte buffer[100];
+
+    file.open(Mode::READ);
+    EXPECT_THROW(file.read(buffer, sizeof(buffer)), std::runtime_error);
+    file.close();
+  }
+
+  // only compressed files are supported
+  EXPECT_THROW(Read_ahead_file(std::make_unique<backend::Memory_file>("")),
+               std::invalid_argument);
+  EXPECT_EQ(nullptr, dynamic_cast<Read_ahead_file *>(
+                         read_ahead(std::make_unique<backend::Memory_file>(""))
+                             .get()));
+  EXPECT_NE(nullptr,
+            dynamic_cast<Read_ahead_file *>(
+                read_ahead(compressed_file(std::string{}, ctype)).get()));
+}
+
 extern "C" const char *g_test_home;
 TEST_P(Compression, compress_decompress_bigdata) {
   SKIP_TEST("Slow test");
@@ -405,7 +541,8 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, ""),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "off"),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "on"),
-        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required")),
+        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required"),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, "")),
     fmt_compr);
 
 }  // namespace tests
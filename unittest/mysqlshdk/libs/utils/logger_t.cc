@@ -26,6 +26,8 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
@@ -254,6 +256,82 @@ TEST_F(Logger_test, log_format) {
   EXPECT_TRUE(tests.empty());
 }
 
+TEST_F(Logger_test, async_log) {
+  const auto name = get_log_file("mylog.txt");
+  shcore::on_leave_scope scope_leave([&name]() {
+    if (!shcore::is_folder(name)) {
+      shcore::delete_file(name);
+    }
+  });
+
+  mysqlsh::Scoped_logger logger(
+      Logger::create_instance(name.c_str(), false, Logger::LOG_INFO));
+
+  const auto l = current_logger();
+
+  l->attach_log_hook(log_hook);
+  l->attach_log_hook(log_all_hook, nullptr, true);
+
+  l->set_async(true);
+  EXPECT_TRUE(l->is_async());
+
+  constexpr int k_threads = 8;
+  constexpr int k_entries = 5000;
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < k_threads; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < k_entries; ++i) {
+        log_info("thread %d entry %d", t, i);
+        log_debug("thread %d debug %d", t, i);
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  l->flush();
+
+  EXPECT_EQ(k_threads * k_entries, hook_executed());
+  EXPECT_EQ(2 * k_threads * k_entries, all_hook_executed());
+
+  l->set_async(false);
+  EXPECT_FALSE(l->is_async());
+
+  log_info("synchronous entry");
+
+  l->detach_log_hook(log_all_hook);
+  l->detach_log_hook(log_hook);
+
+  std::string contents;
+  EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+  // entries of each thread are written in order
+  std::vector<int> next(k_threads, 0);
+  int total = 0;
+
+  for (const auto &line : shcore::str_split(contents, "\n")) {
+    if (line.empty()) continue;
+
+    EXPECT_TRUE(is_timestamp(line.c_str()));
+
+    int t = 0;
+    int i = 0;
+
+    if (2 == sscanf(line.c_str() + 19, ": Info: thread %d entry %d", &t, &i)) {
+      ASSERT_LT(t, k_threads);
+      EXPECT_EQ(next[t], i);
+      next[t] = i + 1;
+      ++total;
+    }
+  }
+
+  EXPECT_EQ(k_threads * k_entries, total);
+  EXPECT_THAT(contents, ::testing::EndsWith(": Info: synchronous entry\n"));
+}
+
 #ifndef _WIN32
 // on Windows Logger is using OutputDebugString() instead of stderr
 
@@ -40,5 +40,20 @@ TEST(ssl, md5) {
   EXPECT_EQ(expected, restricted::md5(data.c_str(), data.length()));
 }
 
+TEST(ssl, sha256_incremental) {
+  const std::string data = "Welcome to Amazon S3.";
+  const auto expected = sha256(data.c_str(), data.length());
+  Sha256 hash;
+
+  hash.update(data.c_str(), 7);
+  hash.update(data.c_str() + 7, data.length() - 7);
+  EXPECT_EQ(expected, hash.digest());
+
+  // digest() resets the state
+  hash.update(data.c_str(), data.length());
+  EXPECT_EQ(expected, hash.digest());
+  EXPECT_EQ(sha256("", 0), hash.digest());
+}
+
 }  // namespace ssl
 }  // namespace shcore
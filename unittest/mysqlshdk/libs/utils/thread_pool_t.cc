@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/thread_pool.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+namespace {
+
+using Task = std::function<void()>;
+
+}  // namespace
+
+TEST(Work_stealing_queue, priorities) {
+  Work_stealing_queue<int> queue{1};
+
+  queue.push(1, Queue_priority::LOW);
+  queue.push(2, Queue_priority::HIGH);
+  queue.push(3, Queue_priority::MEDIUM);
+  queue.shutdown(1);
+  queue.push(4, Queue_priority::LOWEST);
+  queue.push(5, Queue_priority::HIGH);
+
+  EXPECT_EQ(6u, queue.size());
+
+  for (const auto expected : {2, 5, 3, 1, 4, 0}) {
+    EXPECT_EQ(expected, queue.pop(0));
+  }
+
+  EXPECT_EQ(0u, queue.size());
+}
+
+TEST(Work_stealing_queue, steal) {
+  Work_stealing_queue<int> queue{4};
+
+  for (int i = 1; i <= 8; ++i) {
+    queue.push(i);
+  }
+
+  // a single consumer takes all items, including the ones pushed to the queues
+  // of other consumers
+  int sum = 0;
+
+  for (int i = 0; i < 8; ++i) {
+    sum += queue.pop(3);
+  }
+
+  EXPECT_EQ(36, sum);
+  EXPECT_EQ(0u, queue.size());
+}
+
+TEST(Work_stealing_queue, concurrent_shutdown) {
+  constexpr std::size_t k_producers = 4;
+  constexpr std::size_t k_tasks = 10000;
+
+  for (const std::size_t consumers : {1, 8}) {
+    SCOPED_TRACE("consumers: " + std::to_string(consumers));
+
+    for (int round = 0; round < 20; ++round) {
+      Work_stealing_queue<Task> queue{consumers};
+      std::atomic<std::size_t> executed{0};
+      std::vector<std::thread> threads;
+
+      for (std::size_t i = 0; i < consumers; ++i) {
+        threads.emplace_back([&queue, i]() {
+          while (const auto task = queue.pop(i)) {
+            task();
+          }
+        });
+      }
+
+      std::vector<std::thread> producers;
+
+      for (std::size_t i = 0; i < k_producers; ++i) {
+        producers.emplace_back([&queue, &executed]() {
+          for (std::size_t j = 0; j < k_tasks; ++j) {
+            queue.push([&executed]() { ++executed; },
+                       j % 2 ? Queue_priority::LOW : Queue_priority::HIGH);
+          }
+        });
+      }
+
+      for (auto &producer : producers) {
+        producer.join();
+      }
+
+      // consumers are still busy, guards must not be taken before the tasks
+      queue.shutdown(consumers);
+
+      for (auto &thread : threads) {
+        thread.join();
+      }
+
+      EXPECT_EQ(k_producers * k_tasks, executed.load());
+      EXPECT_EQ(0u, queue.size());
+    }
+  }
+}
+
+TEST(Thread_pool, process) {
+  constexpr uint64_t k_tasks = 10000;
+  Thread_pool pool{8};
+  uint64_t sum = 0;
+
+  pool.start_threads();
+
+  for (uint64_t i = 0; i < k_tasks; ++i) {
+    pool.add_task([i]() { return std::to_string(i); },
+                  [&sum](std::string &&data) { sum += std::stoull(data); });
+  }
+
+  pool.tasks_done();
+  pool.process();
+
+  EXPECT_EQ(k_tasks * (k_tasks - 1) / 2, sum);
+}
+
+TEST(Thread_pool, exception) {
+  Thread_pool pool{4};
+
+  pool.start_threads();
+
+  for (int i = 0; i < 100; ++i) {
+    pool.add_task(
+        [i]() -> std::string {
+          if (50 == i) {
+            throw std::runtime_error("failed");
+          }
+
+          return {};
+        },
+        [](std::string &&) {});
+  }
+
+  pool.tasks_done();
+
+  EXPECT_THROW(pool.process(), std::runtime_error);
+}
+
+}  // namespace shcore
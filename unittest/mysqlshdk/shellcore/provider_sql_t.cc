@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils/mocks/gmock_clean.h"
+
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/version.h"
+#include "mysqlshdk/shellcore/provider_sql.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_result.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+
+using ::testing::Contains;
+using ::testing::Not;
+using ::testing::Return;
+
+namespace shcore {
+namespace completer {
+
+TEST(Provider_sql, fetch_columns) {
+  const std::string tables =
+      "SELECT TABLE_NAME FROM INFORMATION_SCHEMA.TABLES WHERE TABLE_TYPE='BASE "
+      "TABLE' AND TABLE_SCHEMA='db'";
+  const std::string views =
+      "SELECT TABLE_NAME FROM INFORMATION_SCHEMA.TABLES WHERE "
+      "TABLE_TYPE<>'BASE TABLE' AND TABLE_SCHEMA='db'";
+  const std::string columns =
+      "SELECT c.TABLE_NAME, c.COLUMN_NAME FROM INFORMATION_SCHEMA.COLUMNS c "
+      "JOIN INFORMATION_SCHEMA.TABLES t ON c.TABLE_SCHEMA=t.TABLE_SCHEMA AND "
+      "c.TABLE_NAME=t.TABLE_NAME WHERE t.TABLE_TYPE";
+  const std::map<std::string, std::vector<std::vector<std::string>>> results =
+      {
+          {"SELECT SCHEMA_NAME FROM INFORMATION_SCHEMA.SCHEMATA", {{"db"}}},
+          {tables, {{"t1"}, {"t2"}, {"t3"}}},
+          {views, {{"v1"}}},
+          // rows of different tables are interleaved, unknown tables are
+          // ignored
+          {columns + "='BASE TABLE' AND c.TABLE_SCHEMA='db'",
+           {{"t2", "t2_b"},
+            {"t1", "t1_z"},
+            {"t1", "t1_a"},
+            {"t4", "t4_a"},
+            {"t2", "t2_a"}}},
+          {columns + "<>'BASE TABLE' AND c.TABLE_SCHEMA='db'",
+           {{"v1", "v1_c"}}},
+      };
+
+  std::vector<std::string> queries;
+  const auto session = std::make_shared<testing::Mock_session>();
+
+  EXPECT_CALL(*session, is_open()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*session, get_server_version())
+      .WillRepeatedly(Return(mysqlshdk::utils::Version(8, 0, 36)));
+
+  session->set_query_handler([&](const std::string &sql) {
+    queries.emplace_back(sql);
+
+    const auto it = results.find(sql);
+    const auto r = std::make_shared<testing::Mock_result>();
+
+    if (results.end() == it) {
+      r->add_result({"a"}, {mysqlshdk::db::Type::String}, {});
+    } else {
+      r->add_result(
+          {"a", "b"},
+          {mysqlshdk::db::Type::String, mysqlshdk::db::Type::String},
+          it->second);
+    }
+
+    return std::static_pointer_cast<mysqlshdk::db::IResult>(r);
+  });
+
+  Provider_sql provider;
+  provider.refresh_name_cache(session, "db", false);
+
+  // one query for columns of all tables, one for columns of all views
+  std::size_t columns_queries = 0;
+
+  for (const auto &query : queries) {
+    if (shcore::str_beginswith(query, "SELECT c.TABLE_NAME, c.COLUMN_NAME")) {
+      ++columns_queries;
+    }
+
+    EXPECT_EQ(std::string::npos, query.find("TABLE_NAME='")) << query;
+  }
+
+  EXPECT_EQ(2, columns_queries);
+
+  const auto complete = [&provider](const std::string &line) {
+    std::size_t offset = 0;
+    return provider.complete("", line, &offset);
+  };
+
+  {
+    const auto list = complete("SELECT * FROM t1 WHERE ");
+    EXPECT_THAT(list, Contains("t1_a"));
+    EXPECT_THAT(list, Contains("t1_z"));
+    EXPECT_THAT(list, Not(Contains("t2_a")));
+    EXPECT_THAT(list, Not(Contains("t4_a")));
+  }
+
+  {
+    const auto list = complete("SELECT * FROM t2 WHERE ");
+    EXPECT_THAT(list, Contains("t2_a"));
+    EXPECT_THAT(list, Contains("t2_b"));
+    EXPECT_THAT(list, Not(Contains("t1_a")));
+  }
+
+  {
+    const auto list = complete("SELECT * FROM t3 WHERE ");
+    EXPECT_THAT(list, Not(Contains("t1_a")));
+    EXPECT_THAT(list, Not(Contains("t2_a")));
+  }
+
+  {
+    const auto list = complete("SELECT * FROM v1 WHERE ");
+    EXPECT_THAT(list, Contains("v1_c"));
+  }
+}
+
+}  // namespace completer
+}  // namespace shcore
@@ -24,7 +24,17 @@
  */
 
 #include <gtest_clean.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 using Print_flags = mysqlsh::Print_flags;
 using Print_flag = mysqlsh::Print_flag;
@@ -69,3 +79,300 @@ TEST(Resultset_dumper, get_data_sizes) {
   // Multibyte character 3 bytes represented in 2 spaces
   TEST_DATA_SIZES("I 爱 MySQL Shell\0", 17, Print_flags(), 16, 17);
 }
+
+TEST(Resultset_dumper, get_data_sizes_long) {
+  TEST_DATA_SIZES("MySQL Shell is great", 20, Print_flags(), 20, 20);
+  TEST_DATA_SIZES("MySQL Shell\tis\ngreat\\", 21, Print_flags(), 21, 21);
+  TEST_DATA_SIZES("MySQL Shell\tis\ngreat\\", 21,
+                  Print_flags(Print_flag::PRINT_CTRL), 24, 24);
+  TEST_DATA_SIZES("MySQL Shell\0is great", 20, Print_flags(), 19, 20);
+  TEST_DATA_SIZES("MySQL Shell\0is great", 20,
+                  Print_flags(Print_flag::PRINT_0_AS_SPC), 20, 20);
+  TEST_DATA_SIZES("MySQL Shell\0is great", 20,
+                  Print_flags(Print_flag::PRINT_0_AS_ESC), 21, 21);
+
+  // Multibyte characters after and before ASCII sequences
+  TEST_DATA_SIZES("MySQL Shell ❤ is great", 24, Print_flags(), 22, 24);
+  TEST_DATA_SIZES("MySQL Shell 爱 MySQL Shell", 27, Print_flags(), 26, 27);
+}
+
+namespace {
+
+using mysqlshdk::db::Column;
+using mysqlshdk::db::IResult;
+using mysqlshdk::db::IRow;
+using mysqlshdk::db::Mutable_result;
+using mysqlshdk::db::Type;
+
+// utf8mb4_0900_ai_ci
+constexpr uint32_t k_utf8mb4 = 255;
+
+Column make_column(const std::string &name, Type type, uint32_t length) {
+  return Column("", "", "", "", name, name, length, 0, type, k_utf8mb4, false,
+                false, false);
+}
+
+/**
+ * Collects the output in the given string.
+ */
+class Test_printer : public mysqlsh::Resultset_printer {
+ public:
+  explicit Test_printer(std::string *output) : m_output(output) {}
+
+  void print(const std::string &s) override { raw_print(s); }
+
+  void println(const std::string &s) override { raw_print(s + "\n"); }
+
+  void raw_print(const std::string &s) override { m_output->append(s); }
+
+  void reset() override { m_output->clear(); }
+
+  std::string data() const override { return *m_output; }
+
+ private:
+  std::string *m_output;
+};
+
+/**
+ * Single result set, records the size of the output at each fetch.
+ */
+class Test_result : public Mutable_result {
+ public:
+  Test_result(const std::vector<Column> &metadata, const std::string *output)
+      : Mutable_result(metadata), m_output(output) {}
+
+  const IRow *fetch_one() override {
+    output_at_fetch.emplace_back(m_output->size());
+    return Mutable_result::fetch_one();
+  }
+
+  bool has_resultset() override { return !m_done; }
+
+  bool next_resultset() override {
+    m_done = true;
+    return false;
+  }
+
+  std::vector<std::size_t> output_at_fetch;
+
+ private:
+  const std::string *m_output;
+  bool m_done = false;
+};
+
+class Test_writer : public mysqlsh::Resultset_writer {
+ public:
+  Test_writer(IResult *target, std::string *output)
+      : Resultset_writer(target, std::make_unique<Test_printer>(output), "off",
+                         "table") {}
+};
+
+std::size_t display_width(const std::string &line) {
+  return std::get<0>(
+      mysqlsh::get_utf8_sizes(line.c_str(), line.length(), Print_flags()));
+}
+
+}  // namespace
+
+class Resultset_dumper_table : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_options = std::make_shared<mysqlsh::Shell_options>();
+    m_scoped_options =
+        std::make_unique<mysqlsh::Scoped_shell_options>(m_options);
+  }
+
+  void TearDown() override { m_scoped_options.reset(); }
+
+  void set_sample_rows(int rows) {
+    m_options->set_and_notify(SHCORE_RESULT_FORMAT_TABLE_SAMPLE_ROWS,
+                              std::to_string(rows));
+  }
+
+  std::unique_ptr<Test_result> make_result(const std::vector<Column> &columns) {
+    return std::make_unique<Test_result>(columns, &m_output);
+  }
+
+  std::vector<std::string> write_table(IResult *result) {
+    Test_writer writer{result, &m_output};
+    const auto output = writer.write_table();
+
+    std::vector<std::string> lines;
+
+    for (auto &line : shcore::str_split(output, "\n")) {
+      if (!line.empty()) lines.emplace_back(std::move(line));
+    }
+
+    return lines;
+  }
+
+  void expect_aligned(const std::vector<std::string> &lines) {
+    ASSERT_FALSE(lines.empty());
+
+    const auto width = display_width(lines[0]);
+
+    for (const auto &line : lines) {
+      SCOPED_TRACE(line);
+      EXPECT_EQ(width, display_width(line));
+    }
+  }
+
+  std::shared_ptr<mysqlsh::Shell_options> m_options;
+  std::unique_ptr<mysqlsh::Scoped_shell_options> m_scoped_options;
+  std::string m_output;
+};
+
+TEST_F(Resultset_dumper_table, default_sample_rows) {
+  EXPECT_EQ(mysqlsh::Shell_options::k_default_table_sample_rows,
+            m_options->get().table_sample_rows);
+}
+
+TEST_F(Resultset_dumper_table, widths_from_metadata) {
+  const std::vector<Column> columns = {make_column("id", Type::Integer, 11),
+                                       make_column("name", Type::String, 20)};
+
+  {
+    // widths are calculated using the values
+    const auto result = make_result(columns);
+    result->append(int64_t{1}, "a");
+    result->append(int64_t{2}, "b");
+
+    const auto lines = write_table(result.get());
+
+    ASSERT_EQ(6, lines.size());
+    EXPECT_EQ("+----+------+", lines[0]);
+    EXPECT_EQ("| id | name |", lines[1]);
+    EXPECT_EQ("|  1 | a    |", lines[3]);
+    expect_aligned(lines);
+  }
+
+  set_sample_rows(0);
+
+  {
+    // widths are calculated using the metadata
+    const auto result = make_result(columns);
+    result->append(int64_t{1}, "a");
+    result->append(int64_t{2}, "b");
+
+    const auto lines = write_table(result.get());
+
+    ASSERT_EQ(6, lines.size());
+    EXPECT_EQ("+-" + std::string(11, '-') + "-+-" + std::string(20, '-') + "-+",
+              lines[0]);
+    EXPECT_EQ("| " + std::string(10, ' ') + "2 | b" + std::string(19, ' ') +
+                  " |",
+              lines[4]);
+    expect_aligned(lines);
+  }
+}
+
+TEST_F(Resultset_dumper_table, stream_rows) {
+  const std::vector<Column> columns = {make_column("id", Type::Integer, 11),
+                                       make_column("name", Type::String, 20)};
+
+  {
+    // all rows are fetched before anything is printed
+    const auto result = make_result(columns);
+    result->append(int64_t{1}, "a");
+    result->append(int64_t{2}, "b");
+    result->append(int64_t{3}, "c");
+
+    write_table(result.get());
+
+    ASSERT_LE(4, result->output_at_fetch.size());
+
+    for (std::size_t i = 0; i < 4; ++i) {
+      EXPECT_EQ(0, result->output_at_fetch[i]);
+    }
+  }
+
+  set_sample_rows(0);
+
+  {
+    // rows are printed as they are fetched
+    const auto result = make_result(columns);
+    result->append(int64_t{1}, "a");
+    result->append(int64_t{2}, "b");
+    result->append(int64_t{3}, "c");
+
+    write_table(result.get());
+
+    ASSERT_EQ(4, result->output_at_fetch.size());
+    EXPECT_EQ(0, result->output_at_fetch[0]);
+
+    for (std::size_t i = 1; i < result->output_at_fetch.size(); ++i) {
+      // header and the previous row were printed
+      EXPECT_LT(result->output_at_fetch[i - 1], result->output_at_fetch[i]);
+    }
+  }
+}
+
+TEST_F(Resultset_dumper_table, unbounded_column_samples_rows) {
+  set_sample_rows(0);
+
+  // TEXT column, metadata does not limit the width of the values
+  const auto result =
+      make_result({make_column("id", Type::Integer, 11),
+                   make_column("notes", Type::String, 262140)});
+  result->append(int64_t{1}, "short");
+  result->append(int64_t{2}, "a bit longer");
+
+  const auto lines = write_table(result.get());
+
+  ASSERT_EQ(6, lines.size());
+  // width of the TEXT column is calculated using the values
+  EXPECT_EQ("+-" + std::string(11, '-') + "-+--------------+", lines[0]);
+  EXPECT_EQ("| " + std::string(10, ' ') + "2 | a bit longer |", lines[4]);
+  expect_aligned(lines);
+
+  // rows are sampled before anything is printed
+  ASSERT_LE(3, result->output_at_fetch.size());
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(0, result->output_at_fetch[i]);
+  }
+}
+
+TEST_F(Resultset_dumper_table, value_wider_than_metadata) {
+  set_sample_rows(0);
+
+  const auto result = make_result({make_column("name", Type::String, 4)});
+  result->append("abcd");
+  result->append("abcdefghij");
+
+  const auto lines = write_table(result.get());
+
+  ASSERT_EQ(6, lines.size());
+  EXPECT_EQ("+------+", lines[0]);
+  EXPECT_EQ("| abcd |", lines[3]);
+  // value is not truncated
+  EXPECT_EQ("| abcdefghij |", lines[4]);
+}
+
+TEST_F(Resultset_dumper_table, multibyte_values) {
+  // VARCHAR(2) using utf8mb4, length is given in bytes
+  const std::vector<Column> columns = {make_column("name", Type::String, 8)};
+
+  for (const auto sample_rows :
+       {mysqlsh::Shell_options::k_default_table_sample_rows, 0}) {
+    SCOPED_TRACE(sample_rows);
+    set_sample_rows(sample_rows);
+
+    const auto result = make_result(columns);
+    // three bytes, one screen space each
+    result->append("❤❤");
+    // three bytes, two screen spaces
+    result->append("爱");
+    // four bytes, two screen spaces
+    result->append("😀");
+    result->append("ab");
+
+    const auto lines = write_table(result.get());
+
+    ASSERT_EQ(8, lines.size());
+    EXPECT_NE(std::string::npos, lines[3].find("❤❤"));
+    EXPECT_NE(std::string::npos, lines[4].find("爱"));
+    EXPECT_NE(std::string::npos, lines[5].find("😀"));
+    expect_aligned(lines);
+  }
+}
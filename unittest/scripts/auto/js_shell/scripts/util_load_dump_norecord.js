@@ -350,6 +350,8 @@ util.loadDump(__tmp_dir+"/ldtest/dump", {deferTableIndexes: true});
 util.loadDump(__tmp_dir+"/ldtest/dump", {updateGtidSet: "xxx"});
 util.loadDump(__tmp_dir+"/ldtest/dump", {updateGtidSet: ""});
 util.loadDump(__tmp_dir+"/ldtest/dump", {updateGtidSet: true});
+util.loadDump(__tmp_dir+"/ldtest/dump", {minThreads: 0});
+util.loadDump(__tmp_dir+"/ldtest/dump", {threads: 2, minThreads: 3});
 
 //@ progressFile errors should be reported before opening the dump
 testutil.rmfile(__tmp_dir+"/ldtest/dump/load-progress*");
@@ -649,6 +651,16 @@ EXPECT_DUMP_LOADED_IGNORE_ACCOUNTS(session);
 testutil.rmfile(__tmp_dir+"/ldtest/dump/load-progress*");
 wipe_instance(session);
 
+//@<> minThreads
+util.loadDump(__tmp_dir+"/ldtest/dump", {threads: 4, minThreads: 1});
+EXPECT_OUTPUT_CONTAINS(" using 4 threads.");
+
+// compare loaded dump except for accounts list
+EXPECT_DUMP_LOADED_IGNORE_ACCOUNTS(session);
+
+testutil.rmfile(__tmp_dir+"/ldtest/dump/load-progress*");
+wipe_instance(session);
+
 //@<> showProgress:true
 // TSFR11_1
 testutil.callMysqlsh([__sandbox_uri1, "--", "util", "load-dump", __tmp_dir+"/ldtest/dump", "--showProgress=true", "--deferTableIndexes=all"]);
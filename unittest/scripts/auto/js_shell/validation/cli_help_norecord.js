@@ -802,8 +802,9 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Compression level may be specified as
-            "gzip;level=8" or "zstd;level=8". Default: "zstd;level=1".
+            "gzip", "zstd", "lz4". Compression level may be specified as
+            "gzip;level=8", "zstd;level=8" or "lz4;level=N", where N is 0-12.
+            Default: "zstd;level=1".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -846,9 +847,19 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows per chunk while a table is being chunked,
+            using the average size of rows which were already dumped, so that
+            the size of chunk files is closer to bytesPerChunk. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--ddlThreads=<uint>
+            Use N additional threads, each with its own connection, to dump the
+            DDL of schemas, tables and views. If set to 0, DDL is dumped by the
+            threads which dump the data. Default: 0.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -1052,8 +1063,9 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Compression level may be specified as
-            "gzip;level=8" or "zstd;level=8". Default: "zstd;level=1".
+            "gzip", "zstd", "lz4". Compression level may be specified as
+            "gzip;level=8", "zstd;level=8" or "lz4;level=N", where N is 0-12.
+            Default: "zstd;level=1".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1096,9 +1108,19 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows per chunk while a table is being chunked,
+            using the average size of rows which were already dumped, so that
+            the size of chunk files is closer to bytesPerChunk. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--ddlThreads=<uint>
+            Use N additional threads, each with its own connection, to dump the
+            DDL of schemas, tables and views. If set to 0, DDL is dumped by the
+            threads which dump the data. Default: 0.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -1283,8 +1305,9 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Compression level may be specified as
-            "gzip;level=8" or "zstd;level=8". Default: "zstd;level=1".
+            "gzip", "zstd", "lz4". Compression level may be specified as
+            "gzip;level=8", "zstd;level=8" or "lz4;level=N", where N is 0-12.
+            Default: "zstd;level=1".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1327,9 +1350,19 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Adjust the number of rows per chunk while a table is being chunked,
+            using the average size of rows which were already dumped, so that
+            the size of chunk files is closer to bytesPerChunk. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--ddlThreads=<uint>
+            Use N additional threads, each with its own connection, to dump the
+            DDL of schemas, tables and views. If set to 0, DDL is dumped by the
+            threads which dump the data. Default: 0.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -1483,8 +1516,9 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Compression level may be specified as
-            "gzip;level=8" or "zstd;level=8". Default: "none".
+            "gzip", "zstd", "lz4". Compression level may be specified as
+            "gzip;level=8", "zstd;level=8" or "lz4;level=N", where N is 0-12.
+            Default: "none".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1528,6 +1562,18 @@ OPTIONS
             A list of valid partition names used to limit the data export to
             just the specified partitions. Default: not set.
 
+--threads=<uint>
+            Use N threads to export the table data. If set to a value greater
+            than 1, the table is split into chunks, which are exported in
+            parallel to temporary files and then merged in order into the
+            output file. In this case, all threads use a consistent snapshot of
+            the data, which requires the table to be briefly locked. Default:
+            1.
+
+--bytesPerChunk=<str>
+            Sets average estimated number of bytes to be written to each chunk,
+            used only if threads is greater than 1. Default: "64M".
+
 --osBucketName=<str>
             Use specified OCI bucket for the location of the dump. Default: not
             set.
@@ -1835,6 +1881,14 @@ OPTIONS
             option in case of a local dump, or four times that value in case on
             a non-local dump. Default: not set.
 
+--minThreads=<uint>
+            If set, the number of threads which are loading the data is
+            adjusted during the load, between this value and the value of the
+            threads option. It is reduced when the destination server is under
+            pressure (i.e. InnoDB is waiting for free pages in the buffer pool
+            or the redo log is almost full), and increased as long as this
+            improves the throughput. Default: not set.
+
 --showProgress=<bool>
             Enable or disable import progress information. Default: true if
             stdout is a tty, false otherwise.
@@ -1919,6 +1973,23 @@ OPTIONS
             backtick characters when required. By default, all triggers are
             included. Default: not set.
 
+--where=<key>[:<type>]=<value>
+            A key-value pair of a table name in the format of schema.table and
+            a valid SQL condition expression used to filter the rows being
+            loaded. Each chunk of such table is loaded into a temporary table
+            first, then rows matching the condition are copied to the
+            destination table. Condition may refer to the columns specified by
+            the excludeColumns option. Tables with a condition are not BULK
+            LOADED. Cannot be used together with the checksum option. Default:
+            not set.
+
+--excludeColumns=<str list>
+            Skip loading data of the specified columns, these are set to their
+            default values instead. Strings are in format schema.table.column,
+            quoted using backtick characters when required. Tables with
+            excluded columns are not BULK LOADED. Cannot be used together with
+            the checksum option. Default: not set.
+
 --characterSet=<str>
             Overrides the character set to be used for loading dump data. By
             default, the same character set used for dumping will be used
@@ -160,6 +160,22 @@ Usage: mysqlsh [OPTIONS] [URI]
                                    be an integer between 1 and 8 or any of
                                    [none, internal, error, warning, info,
                                    debug, debug2, debug3] respectively.
+  --log-async                      Write the log asynchronously, using a
+                                   background thread. Reduces the overhead of
+                                   logging in multi-threaded operations.
+  --sql-batch-size=<#>             In SQL batch mode, send up to <#> consecutive
+                                   INSERT, UPDATE, DELETE and REPLACE statements
+                                   to the server in a single multi-statement
+                                   packet. Requires a classic session. Default:
+                                   1 (disabled).
+  --startup-profile                Print the time spent in each phase of the
+                                   startup to stderr, before executing the
+                                   requested operation.
+  --lazy-init                      Defer loading of plugins and initialization
+                                   of Python until they are needed. Plugins are
+                                   not loaded when calling an operation of a
+                                   built-in object using the command line
+                                   integration.
   --dba-log-sql[={0|1|2}]          Log SQL statements executed by AdminAPI
                                    operations: 0 - logging disabled; 1 - log
                                    statements other than SELECT and SHOW; 2 -
@@ -179,6 +179,10 @@ DESCRIPTION
       - passwordsFromStdin: boolean value that indicates if the shell should
         read passwords from stdin instead of the tty
       - resultFormat: controls the type of output produced for SQL results.
+      - resultFormat.tableSampleRows: number of rows used to calculate column
+        widths when printing results in table format. If 0, widths are
+        calculated using column metadata and rows are printed as they are
+        fetched. Default is 1000.
       - sandboxDir: default path where the new sandbox instances for InnoDB
         cluster will be deployed
       - showColumnTypeInfo: display column type information in SQL mode. Please
@@ -198,6 +202,10 @@ DESCRIPTION
         (~/.ssh/config).
       - ssh.bufferSize integer default 10240 bytes, used for tunnel data
         transfer
+      - rest.maxConnections integer default 8, maximum number of idle
+        connections kept alive to the object storage services.
+      - rest.http2 boolean default false, if enabled HTTP/2 is negotiated when
+        connecting to the object storage services.
 
       The resultFormat option supports the following values to modify the
       format of printed query results:
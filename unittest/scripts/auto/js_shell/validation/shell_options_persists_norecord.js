@@ -330,7 +330,10 @@
  outputFormat                    table
  pager                           ""
  passwordsFromStdin              false
+ rest.http2                      false
+ rest.maxConnections             8
  resultFormat                    table
+ resultFormat.tableSampleRows    1000
  sandboxDir                      <<<_defaultSandboxDir>>>
  showColumnTypeInfo              false
  showWarnings                    true
@@ -370,7 +373,10 @@
  outputFormat                    table (Compiled default)
  pager                           "" (Compiled default)
  passwordsFromStdin              false (Compiled default)
+ rest.http2                      false (Compiled default)
+ rest.maxConnections             8 (Compiled default)
  resultFormat                    table (Compiled default)
+ resultFormat.tableSampleRows    1000 (Compiled default)
  sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
  showColumnTypeInfo              false (Compiled default)
  showWarnings                    true (Compiled default)
@@ -491,7 +497,10 @@
  outputFormat                    table
  pager                           ""
  passwordsFromStdin              false
+ rest.http2                      false
+ rest.maxConnections             8
  resultFormat                    table
+ resultFormat.tableSampleRows    1000
  sandboxDir                      <<<_defaultSandboxDir>>>
  showColumnTypeInfo              false
  showWarnings                    true
@@ -532,7 +541,10 @@ Switching to SQL mode... Commands end with ;
  outputFormat                    table (Compiled default)
  pager                           "" (Compiled default)
  passwordsFromStdin              false (Compiled default)
+ rest.http2                      false (Compiled default)
+ rest.maxConnections             8 (Compiled default)
  resultFormat                    table (Compiled default)
+ resultFormat.tableSampleRows    1000 (Compiled default)
  sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
  showColumnTypeInfo              false (Compiled default)
  showWarnings                    true (Compiled default)
@@ -599,8 +599,15 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows per
+        chunk while a table is being chunked, using the average size of rows
+        which were already dumped, so that the size of chunk files is closer to
+        bytesPerChunk.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - ddlThreads: int (default: 0) - Use N additional threads, each with its
+        own connection, to dump the DDL of schemas, tables and views. If set to
+        0, DDL is dumped by the threads which dump the data.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -627,8 +634,9 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd;level=1") - Compression used when
-        writing the data dump files, one of: "none", "gzip", "zstd".
-        Compression level may be specified as "gzip;level=8" or "zstd;level=8".
+        writing the data dump files, one of: "none", "gzip", "zstd", "lz4".
+        Compression level may be specified as "gzip;level=8", "zstd;level=8" or
+        "lz4;level=N", where N is 0-12.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1245,8 +1253,15 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows per
+        chunk while a table is being chunked, using the average size of rows
+        which were already dumped, so that the size of chunk files is closer to
+        bytesPerChunk.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - ddlThreads: int (default: 0) - Use N additional threads, each with its
+        own connection, to dump the DDL of schemas, tables and views. If set to
+        0, DDL is dumped by the threads which dump the data.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -1273,8 +1288,9 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd;level=1") - Compression used when
-        writing the data dump files, one of: "none", "gzip", "zstd".
-        Compression level may be specified as "gzip;level=8" or "zstd;level=8".
+        writing the data dump files, one of: "none", "gzip", "zstd", "lz4".
+        Compression level may be specified as "gzip;level=8", "zstd;level=8" or
+        "lz4;level=N", where N is 0-12.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1868,8 +1884,15 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust the number of rows per
+        chunk while a table is being chunked, using the average size of rows
+        which were already dumped, so that the size of chunk files is closer to
+        bytesPerChunk.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - ddlThreads: int (default: 0) - Use N additional threads, each with its
+        own connection, to dump the DDL of schemas, tables and views. If set to
+        0, DDL is dumped by the threads which dump the data.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -1896,8 +1919,9 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd;level=1") - Compression used when
-        writing the data dump files, one of: "none", "gzip", "zstd".
-        Compression level may be specified as "gzip;level=8" or "zstd;level=8".
+        writing the data dump files, one of: "none", "gzip", "zstd", "lz4".
+        Compression level may be specified as "gzip;level=8", "zstd;level=8" or
+        "lz4;level=N", where N is 0-12.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -2441,6 +2465,14 @@ DESCRIPTION
       - partitions: list of strings (default: not set) - A list of valid
         partition names used to limit the data export to just the specified
         partitions.
+      - threads: int (default: 1) - Use N threads to export the table data. If
+        set to a value greater than 1, the table is split into chunks, which
+        are exported in parallel to temporary files and then merged in order
+        into the output file. In this case, all threads use a consistent
+        snapshot of the data, which requires the table to be briefly locked.
+      - bytesPerChunk: string (default: "64M") - Sets average estimated number
+        of bytes to be written to each chunk, used only if threads is greater
+        than 1.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -2467,8 +2499,9 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "none") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd". Compression level
-        may be specified as "gzip;level=8" or "zstd;level=8".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression
+        level may be specified as "gzip;level=8", "zstd;level=8" or
+        "lz4;level=N", where N is 0-12.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -3271,7 +3304,10 @@ DESCRIPTION
 
       If target MySQL server supports BULK LOAD, the load operation of
       compatible tables can be offloaded to the target server, which
-      parallelizes and loads data directly from the Cloud storage.
+      parallelizes and loads data directly from the Cloud storage. If target
+      server cannot access the dump files, data of tables with a primary key is
+      streamed by the client using LOAD DATA LOCAL INFILE, and still loaded
+      using BULK LOAD, if both server and table support it.
 
       Resuming
 
@@ -3333,6 +3369,11 @@ DESCRIPTION
         to load the data, even when available.
       - dryRun: bool (default: false) - Scans the dump and prints everything
         that would be performed, without actually doing so.
+      - excludeColumns: array of strings (default not set) - Skip loading data
+        of the specified columns, these are set to their default values
+        instead. Strings are in format schema.table.column, quoted using
+        backtick characters when required. Tables with excluded columns are not
+        BULK LOADED. Cannot be used together with the checksum option.
       - excludeEvents: array of strings (default not set) - Skip loading
         specified events from the dump. Strings are in format schema.event,
         quoted using backtick characters when required.
@@ -3405,6 +3446,12 @@ DESCRIPTION
         not specified explicitly, the value of the bytesPerChunk dump option is
         used, but only in case of the files with data size greater than 1.5 *
         bytesPerChunk. Not used if table is BULK LOADED.
+      - minThreads: int (default not set) - If set, the number of threads which
+        are loading the data is adjusted during the load, between this value
+        and the value of the threads option. It is reduced when the destination
+        server is under pressure (i.e. InnoDB is waiting for free pages in the
+        buffer pool or the redo log is almost full), and increased as long as
+        this improves the throughput.
       - progressFile: path (default: load-progress.<server_uuid>.progress) -
         Stores load progress information in the given local file path.
       - resetProgress: bool (default: false) - Discards progress information of
@@ -3430,6 +3477,13 @@ DESCRIPTION
         being created. Once all uploaded tables are processed the command will
         either wait for more data, the dump is marked as completed or the given
         timeout (in seconds) passes. <= 0 disables waiting.
+      - where: dictionary (default: not set) - A key-value pair of a table name
+        in the format of schema.table and a valid SQL condition expression used
+        to filter the rows being loaded. Each chunk of such table is loaded
+        into a temporary table first, then rows matching the condition are
+        copied to the destination table. Condition may refer to the columns
+        specified by the excludeColumns option. Tables with a condition are not
+        BULK LOADED. Cannot be used together with the checksum option.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -24,6 +24,8 @@ Util.loadDump: Argument #2: Option 'deferTableIndexes' is expected to be of type
 Util.loadDump: Argument #2: Invalid value 'xxx' for updateGtidSet option, allowed values: 'append', 'off' and 'replace'. (ArgumentError)
 Util.loadDump: Argument #2: Invalid value '' for updateGtidSet option, allowed values: 'append', 'off' and 'replace'. (ArgumentError)
 Util.loadDump: Argument #2: Option 'updateGtidSet' is expected to be of type String, but is Bool (TypeError)
+Util.loadDump: Argument #2: The value of the 'minThreads' option must be a positive integer not greater than the value of the 'threads' option. (ArgumentError)
+Util.loadDump: Argument #2: The value of the 'minThreads' option must be a positive integer not greater than the value of the 'threads' option. (ArgumentError)
 
 //@# progressFile errors should be reported before opening the dump
 |Loading DDL and Data from '<<<__tmp_dir>>>/ldtest/dump' using 4 threads.|
@@ -115,15 +115,16 @@ EXPECT_SHELL_LOG_CONTAINS("BULK LOAD is supported")
 # monitoring is disabled
 EXPECT_SHELL_LOG_CONTAINS("BULK LOAD monitoring: consumer is disabled")
 
-#@<> BUG#36297348 - bulk load should be disabled if s3EndpointOverride is used {bulk_load_supported}
-# we're using a valid S3 endpoint, the same which would be used normally
-TEST_LOAD(expect_bulk_loaded = 0, options = { "s3EndpointOverride": f"https://s3.{aws_settings.get('region', default_aws_region)}.amazonaws.com" })
+#@<> BUG#36297348 - bulk load should not read from S3 if s3EndpointOverride is used {bulk_load_supported}
+# we're using a valid S3 endpoint, the same which would be used normally, data is streamed by the client
+TEST_LOAD(expect_bulk_loaded = 1, options = { "s3EndpointOverride": f"https://s3.{aws_settings.get('region', default_aws_region)}.amazonaws.com" })
+EXPECT_SHELL_LOG_CONTAINS("BULK LOAD: unsupported FS, using LOCAL input")
 
 #@<> WL15432-TSFR_1_7 - missing privilege {bulk_load_supported}
 revoke_bulk_Load_privilege(dst_session)
 
-TEST_LOAD(expect_bulk_loaded = 0)
-EXPECT_SHELL_LOG_CONTAINS("BULK LOAD: AWS S3 and 'LOAD_FROM_S3' privilege is missing")
+TEST_LOAD(expect_bulk_loaded = 1)
+EXPECT_SHELL_LOG_CONTAINS("BULK LOAD: AWS S3 and 'LOAD_FROM_S3' privilege is missing, using LOCAL input")
 
 #@<> WL15432-TSFR_1_7 - re-add privilege {bulk_load_supported}
 grant_bulk_Load_privilege(dst_session)
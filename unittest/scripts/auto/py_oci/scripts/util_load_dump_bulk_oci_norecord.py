@@ -106,8 +106,8 @@ EXPECT_SHELL_LOG_CONTAINS("BULK LOAD is supported")
 par = load_src
 load_src = dump_dir
 
-TEST_LOAD(expect_bulk_loaded = 0, options = { "osBucketName": OS_BUCKET_NAME, "osNamespace": OS_NAMESPACE, "ociConfigFile": oci_config_file })
-EXPECT_SHELL_LOG_CONTAINS("BULK LOAD: unsupported FS")
+TEST_LOAD(expect_bulk_loaded = 1, options = { "osBucketName": OS_BUCKET_NAME, "osNamespace": OS_NAMESPACE, "ociConfigFile": oci_config_file })
+EXPECT_SHELL_LOG_CONTAINS("BULK LOAD: unsupported FS, using LOCAL input")
 
 load_src = par
 
@@ -149,8 +149,8 @@ unload_bulk_load(src_session)
 #@<> WL15432-TSFR_1_6 - missing privilege {bulk_load_supported}
 revoke_bulk_Load_privilege(dst_session)
 
-TEST_LOAD(expect_bulk_loaded = 0)
-EXPECT_SHELL_LOG_CONTAINS("BULK LOAD: OCI prefix PAR and 'LOAD_FROM_URL' privilege is missing")
+TEST_LOAD(expect_bulk_loaded = 1)
+EXPECT_SHELL_LOG_CONTAINS("BULK LOAD: OCI prefix PAR and 'LOAD_FROM_URL' privilege is missing, using LOCAL input")
 
 #@<> WL15432-TSFR_1_6 - re-add privilege {bulk_load_supported}
 grant_bulk_Load_privilege(dst_session)
@@ -204,6 +204,69 @@ local_session.close()
 remote_session.close()
 EXPECT_EQ(0, len(shell.list_ssh_connections()))
 
+#@<> concurrent transfers through multiple tunnelled connections {VER(> 8.0.0)}
+# each thread of dump/load uses its own connection, all of them are channels
+# of the same SSH tunnel, data needs to be transferred intact in both
+# directions while all channels are busy
+concurrent_schema = "ssh_concurrent"
+concurrent_tables = 8
+concurrent_threads = 8
+
+local_session = mysql.get_session(__sandbox_uri1)
+local_session.run_sql("CREATE SCHEMA !", [concurrent_schema])
+local_session.run_sql("SET SESSION cte_max_recursion_depth = 2000")
+
+for i in range(concurrent_tables):
+  local_session.run_sql(f"CREATE TABLE !.t{i} (id INT PRIMARY KEY, data LONGTEXT)", [concurrent_schema])
+  # ~16MB of data per table, rows are larger than the tunnel buffer
+  local_session.run_sql(f"""INSERT INTO !.t{i}
+    WITH RECURSIVE seq (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < 2000)
+    SELECT n, REPEAT(SHA2(CONCAT(n, '-', {i}), 256), 128) FROM seq""", [concurrent_schema])
+
+local_session.close()
+
+# dump locally, load over SSH
+shell.connect(__sandbox_uri1)
+EXPECT_NO_THROWS(lambda: util.dump_schemas([concurrent_schema], os.path.join(outdir, "dump_concurrent_local"), {"threads": concurrent_threads, "bytesPerChunk": "1M", "showProgress": False}), "Unable to dump schema")
+session.close()
+
+shell.connect({"uri": MYSQL_OVER_SSH_URI, "ssh": SSH_URI_NOPASS, "ssh-password": SSH_PASS, "ssh-config-file": config_file})
+EXPECT_NO_THROWS(lambda: util.load_dump(os.path.join(outdir, "dump_concurrent_local"), {"threads": concurrent_threads, "ignoreVersion": True, "showProgress": False}), "Unable to load dump")
+session.close()
+EXPECT_EQ(0, len(shell.list_ssh_connections()))
+
+local_session = mysql.get_session(__sandbox_uri1)
+remote_session = mysql.get_session({"uri": MYSQL_OVER_SSH_URI, "ssh": SSH_URI_NOPASS, "ssh-password": SSH_PASS, "ssh-config-file": config_file})
+compare_schema(local_session, remote_session, concurrent_schema, check_rows=True)
+local_session.close()
+remote_session.close()
+
+# make sure that the instance over SSH has a supported version
+if __mysh_version_num >= mysql_over_ssh_version:
+  # dump over SSH, load locally
+  shell.connect({"uri": MYSQL_OVER_SSH_URI, "ssh": SSH_URI_NOPASS, "ssh-password": SSH_PASS, "ssh-config-file": config_file})
+  EXPECT_NO_THROWS(lambda: util.dump_schemas([concurrent_schema], os.path.join(outdir, "dump_concurrent_ssh"), {"threads": concurrent_threads, "bytesPerChunk": "1M", "showProgress": False}), "Unable to dump schema")
+  session.close()
+  EXPECT_EQ(0, len(shell.list_ssh_connections()))
+  shell.connect(__sandbox_uri1)
+  session.run_sql("DROP SCHEMA !", [concurrent_schema])
+  EXPECT_NO_THROWS(lambda: util.load_dump(os.path.join(outdir, "dump_concurrent_ssh"), {"threads": concurrent_threads, "ignoreVersion": True, "showProgress": False}), "Unable to load dump")
+  session.close()
+  local_session = mysql.get_session(__sandbox_uri1)
+  remote_session = mysql.get_session({"uri": MYSQL_OVER_SSH_URI, "ssh": SSH_URI_NOPASS, "ssh-password": SSH_PASS, "ssh-config-file": config_file})
+  compare_schema(local_session, remote_session, concurrent_schema, check_rows=True)
+  local_session.close()
+  remote_session.close()
+
+# Clean the data in both places
+local_session = mysql.get_session(__sandbox_uri1)
+remote_session = mysql.get_session({"uri": MYSQL_OVER_SSH_URI, "ssh": SSH_URI_NOPASS, "ssh-password": SSH_PASS, "ssh-config-file": config_file})
+clean_server(local_session)
+clean_server(remote_session)
+local_session.close()
+remote_session.close()
+EXPECT_EQ(0, len(shell.list_ssh_connections()))
+
 #@<> X Protocol Tests {VER(> 8.0.0)}
 # Loads a dump using SSH session through X protocol
 shell.connect({"uri": f"mysqlx://{MYSQL_OVER_SSH_URI}0", "ssh": SSH_URI_NOPASS, "ssh-password": SSH_PASS, "ssh-config-file": config_file})
@@ -3323,6 +3323,285 @@ compare_schema(session1, session2, tested_schema, check_rows=True)
 shell.connect(__sandbox_uri1)
 session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
 
+#@<> load a subset of rows and columns - setup
+tested_schema = "row_filter"
+dump_dir = os.path.join(outdir, "row_filter")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+session.run_sql("CREATE SCHEMA !", [tested_schema])
+session.run_sql("CREATE TABLE !.t1 (id INT PRIMARY KEY, tenant INT NOT NULL, payload VARCHAR(32), secret VARCHAR(32) DEFAULT 'hidden')", [tested_schema])
+session.run_sql("CREATE TABLE !.t2 (id INT PRIMARY KEY, tenant INT)", [tested_schema])
+
+for i in range(1000):
+    session.run_sql("INSERT INTO !.t1 VALUES (?, ?, ?, ?)", [tested_schema, i, i % 10, f"payload {i}", f"secret {i}"])
+    session.run_sql("INSERT INTO !.t2 VALUES (?, ?)", [tested_schema, i, i % 10])
+
+util.dump_schemas([tested_schema], dump_dir, { "bytesPerChunk": "128k", "showProgress": False })
+
+#@<> load a subset of rows and columns - invalid options
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "where": { "t1": "tenant = 1" } }), "ValueError: Util.load_dump: Argument #2: The table name key of the 'where' option must be in the following form: schema.table, with optional backtick quotes, wrong value: 't1'.")
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "where": { f"{tested_schema}.t1": "tenant = 1) OR (1 = 1" } }), f"ValueError: Util.load_dump: Argument #2: Malformed condition used for table '{tested_schema}'.'t1': tenant = 1) OR (1 = 1")
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "excludeColumns": [ "t1.secret" ] }), "ValueError: Util.load_dump: Argument #2: The column to be excluded must be in the following form: schema.table.column, with optional backtick quotes, wrong value: 't1.secret'.")
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "where": { f"{tested_schema}.t1": "tenant = 1" }, "checksum": True }), "ValueError: Util.load_dump: Argument #2: The 'checksum' option cannot be used when the 'where' or 'excludeColumns' option is set.")
+
+#@<> load a subset of rows and columns - test
+shell.connect(__sandbox_uri2)
+wipeout_server(session)
+
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "where": { f"`{tested_schema}`.`t2`": "tenant IN (2, 3) AND id < 500" }, "excludeColumns": [ f"{tested_schema}.t1.secret", f"{tested_schema}.t2.tenant" ], "showProgress": False }), "Load should not fail")
+
+# all rows of t1 are loaded, excluded column is set to its default value
+EXPECT_EQ(1000, session.run_sql("SELECT COUNT(*) FROM !.t1", [tested_schema]).fetch_one()[0])
+EXPECT_EQ(0, session.run_sql("SELECT COUNT(*) FROM !.t1 WHERE secret <> 'hidden' OR tenant <> id % 10 OR payload <> CONCAT('payload ', id)", [tested_schema]).fetch_one()[0])
+# condition of t2 refers to the excluded column
+EXPECT_EQ(100, session.run_sql("SELECT COUNT(*) FROM !.t2", [tested_schema]).fetch_one()[0])
+EXPECT_EQ(0, session.run_sql("SELECT COUNT(*) FROM !.t2 WHERE tenant IS NOT NULL OR id % 10 NOT IN (2, 3) OR id >= 500", [tested_schema]).fetch_one()[0])
+
+#@<> load a subset of rows and columns - matching rows are copied in multiple transactions
+wipeout_server(session)
+old_log_sql = shell.options["logSql"]
+shell.options["logSql"] = "all"
+WIPE_SHELL_LOG()
+
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "where": { f"{tested_schema}.t2": "tenant IN (2, 3)" }, "maxBytesPerTransaction": "4k", "showProgress": False }), "Load should not fail")
+
+shell.options["logSql"] = old_log_sql
+
+EXPECT_EQ(200, session.run_sql("SELECT COUNT(*) FROM !.t2", [tested_schema]).fetch_one()[0])
+# chunk is bigger than maxBytesPerTransaction, rows are copied in ranges
+EXPECT_SHELL_LOG_CONTAINS("`__mysqlsh_row_id` BETWEEN 1 AND ")
+EXPECT_GT(len(testutil.grep_file(testutil.get_shell_log_path(), f"REPLACE INTO `{tested_schema}`.`t2`")), 1)
+
+#@<> load a subset of rows and columns - table with an invisible primary key {VER(>= 8.0.23)}
+shell.connect(__sandbox_uri1)
+session.run_sql("CREATE TABLE !.t3 (my_row_id BIGINT UNSIGNED NOT NULL AUTO_INCREMENT INVISIBLE PRIMARY KEY, tenant INT)", [tested_schema])
+
+for i in range(100):
+    session.run_sql("INSERT INTO !.t3 (tenant) VALUES (?)", [tested_schema, i % 10])
+
+invisible_pk_dump_dir = os.path.join(outdir, "row_filter_invisible_pk")
+util.dump_tables(tested_schema, [ "t3" ], invisible_pk_dump_dir, { "showProgress": False })
+session.run_sql("DROP TABLE !.t3", [tested_schema])
+
+shell.connect(__sandbox_uri2)
+wipeout_server(session)
+
+# invisible column is written to the dump, staging table needs to have it
+EXPECT_NO_THROWS(lambda: util.load_dump(invisible_pk_dump_dir, { "where": { f"{tested_schema}.t3": "tenant = 1 AND my_row_id > 50" }, "showProgress": False }), "Load should not fail")
+
+EXPECT_EQ([ 52, 62, 72, 82, 92 ], [ row[0] for row in session.run_sql("SELECT my_row_id FROM !.t3 ORDER BY my_row_id", [tested_schema]).fetch_all() ])
+EXPECT_EQ(0, session.run_sql("SELECT COUNT(*) FROM !.t3 WHERE tenant <> 1", [tested_schema]).fetch_one()[0])
+
+#@<> load a subset of rows and columns - cleanup
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+
+#@<> chunk ranges in the dump metadata - setup
+tested_schema = "chunk_ranges"
+dump_dir = os.path.join(outdir, "chunk_ranges")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+session.run_sql("CREATE SCHEMA !", [tested_schema])
+session.run_sql("CREATE TABLE !.t_int (id INT PRIMARY KEY, data VARCHAR(32))", [tested_schema])
+session.run_sql("CREATE TABLE !.t_str (id VARCHAR(16) PRIMARY KEY, data VARCHAR(32))", [tested_schema])
+session.run_sql("CREATE TABLE !.t_no_index (data VARCHAR(32))", [tested_schema])
+
+for i in range(1000):
+    session.run_sql("INSERT INTO !.t_int VALUES (?, ?)", [tested_schema, i, f"data {i}"])
+    session.run_sql("INSERT INTO !.t_str VALUES (?, ?)", [tested_schema, f"{i:04}", f"data {i}"])
+    session.run_sql("INSERT INTO !.t_no_index VALUES (?)", [tested_schema, f"data {i}"])
+
+session.run_sql("ANALYZE TABLE !.t_int, !.t_str, !.t_no_index", [tested_schema, tested_schema, tested_schema])
+
+#@<> chunk ranges in the dump metadata - test
+EXPECT_NO_THROWS(lambda: util.dump_schemas([tested_schema], dump_dir, { "bytesPerChunk": "128k", "showProgress": False }), "Dump should not fail")
+
+done = read_json(os.path.join(dump_dir, "@.done.json"))
+
+def chunk_files(table):
+    return sorted([f for f in done["chunkFileRows"] if f.startswith(f"{tested_schema}@{table}@")])
+
+for table in [ "t_int", "t_str", "t_no_index" ]:
+    # number of rows of each chunk is stored, they add up to the number of rows of the table
+    files = chunk_files(table)
+    EXPECT_NE(0, len(files), table)
+    EXPECT_EQ(1000, sum([done["chunkFileRows"][f] for f in files]), table)
+    EXPECT_EQ(done["tableRows"][tested_schema][table], sum([done["chunkFileRows"][f] for f in files]), table)
+    EXPECT_EQ(files, sorted([f for f in done["chunkFileBytes"] if f.startswith(f"{tested_schema}@{table}@")]), table)
+
+# range of the index is stored for tables chunked using an index
+EXPECT_EQ({ "begin": [ "0" ], "end": [ "999" ] }, done["chunkRanges"][chunk_files("t_int")[0]])
+EXPECT_EQ({ "begin": [ "0000" ], "end": [ "0999" ] }, done["chunkRanges"][chunk_files("t_str")[0]])
+
+for f in chunk_files("t_no_index"):
+    EXPECT_FALSE(f in done["chunkRanges"], f)
+
+#@<> chunk ranges in the dump metadata - load
+shell.connect(__sandbox_uri2)
+wipeout_server(session)
+old_log_level = shell.options["logLevel"]
+shell.options["logLevel"] = 6
+WIPE_SHELL_LOG()
+
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "showProgress": False }), "Load should not fail")
+
+shell.options["logLevel"] = old_log_level
+
+for table in [ "t_int", "t_str", "t_no_index" ]:
+    EXPECT_EQ(1000, session.run_sql("SELECT COUNT(*) FROM !.!", [tested_schema, table]).fetch_one()[0], table)
+
+# row counts and index ranges of chunks are read from the metadata
+EXPECT_SHELL_LOG_CONTAINS(f"Scheduling chunk for table `{tested_schema}`.`t_int` (chunk 0)*, rows: 1000, range: [0] - [999]")
+EXPECT_SHELL_LOG_CONTAINS(f"Scheduling chunk for table `{tested_schema}`.`t_str` (chunk 0)*, rows: 1000, range: [0000] - [0999]")
+EXPECT_SHELL_LOG_CONTAINS(f"Scheduling chunk for table `{tested_schema}`.`t_no_index` (chunk 0)*, rows: 1000")
+
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+shell.connect(__sandbox_uri1)
+
+#@<> chunk ranges in the dump metadata - cleanup
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+
+#@<> lz4 compression - setup
+tested_schema = "lz4_compression"
+dump_dir = os.path.join(outdir, "lz4_compression")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+session.run_sql("CREATE SCHEMA !", [tested_schema])
+session.run_sql("CREATE TABLE !.t (id INT PRIMARY KEY, data VARCHAR(32))", [tested_schema])
+
+for i in range(1000):
+    session.run_sql("INSERT INTO !.t VALUES (?, ?)", [tested_schema, i, f"data {i}"])
+
+#@<> lz4 compression - test
+EXPECT_NO_THROWS(lambda: util.dump_schemas([tested_schema], dump_dir, { "compression": "lz4", "bytesPerChunk": "128k", "showProgress": False }), "Dump should not fail")
+EXPECT_NE(0, len([f for f in os.listdir(dump_dir) if f.endswith(".tsv.lz4")]))
+
+shell.connect(__sandbox_uri2)
+wipeout_server(session)
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "showProgress": False }), "Load should not fail")
+
+compare_schema(session1, session2, tested_schema, check_rows=True)
+
+#@<> lz4 compression - cleanup
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+shell.connect(__sandbox_uri2)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+
+#@<> BULK LOAD with LOCAL input - setup {not __dbug_off and __version_num >= 80400}
+tested_schema = "bulk_load_local"
+dump_dir = os.path.join(outdir, "bulk_load_local")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+session.run_sql("CREATE SCHEMA !", [tested_schema])
+session.run_sql("CREATE TABLE !.t_pk (id INT PRIMARY KEY, data VARCHAR(128))", [tested_schema])
+session.run_sql("CREATE TABLE !.t_json (id INT PRIMARY KEY, data JSON)", [tested_schema])
+session.run_sql("CREATE TABLE !.t_no_pk (data VARCHAR(128))", [tested_schema])
+session.run_sql("SET @@SESSION.cte_max_recursion_depth = 10000")
+session.run_sql("INSERT INTO !.t_pk WITH RECURSIVE s (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM s WHERE n < 10000) SELECT n, REPEAT(MD5(n), 3) FROM s", [tested_schema])
+session.run_sql("INSERT INTO !.t_json SELECT id, JSON_OBJECT('id', id) FROM !.t_pk WHERE id <= 1000", [tested_schema, tested_schema])
+session.run_sql("INSERT INTO !.t_no_pk SELECT data FROM !.t_pk WHERE id <= 1000", [tested_schema, tested_schema])
+session.run_sql("ANALYZE TABLE !.t_pk, !.t_json, !.t_no_pk", [tested_schema, tested_schema, tested_schema])
+
+# table is split into multiple chunks which are streamed as a single file
+EXPECT_NO_THROWS(lambda: util.dump_schemas([tested_schema], dump_dir, { "compression": "gzip", "bytesPerChunk": "128k", "showProgress": False }), "Dump should not fail")
+EXPECT_LT(1, len([f for f in os.listdir(dump_dir) if f.startswith(f"{tested_schema}@t_pk@") and f.endswith(".tsv.gz")]))
+
+shell.connect(__sandbox_uri2)
+bulk_load_supported = enable_bulk_load(session)
+
+#@<> BULK LOAD with LOCAL input - test {not __dbug_off and __version_num >= 80400 and bulk_load_supported}
+# server is not going to be able to read the dump files
+testutil.dbug_set("+d,dump_loader_bulk_local_input")
+wipeout_server(session)
+WIPE_SHELL_LOG()
+
+# gzip is decompressed by the client, BULK LOAD of the remote files does not support it
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "skipBinlog": True, "showProgress": False }), "Load should not fail")
+EXPECT_STDOUT_CONTAINS("1 table was loaded using BULK LOAD.")
+EXPECT_SHELL_LOG_CONTAINS("BULK LOAD: unsupported FS, using LOCAL input")
+EXPECT_SHELL_LOG_CONTAINS(f"Table `{tested_schema}`.`t_pk` will use BULK LOAD")
+# table is not tested before it's loaded, it's loaded in chunks once server rejects the LOCAL input
+EXPECT_SHELL_LOG_CONTAINS(f"Table `{tested_schema}`.`t_json` is not compatible with BULK LOAD: MySQL Error 3658 (HY000): Feature json column type is unsupported (LOAD DATA ALGORITHM = BULK)")
+EXPECT_SHELL_LOG_CONTAINS(f"Table `{tested_schema}`.`t_json` will not use BULK LOAD: not compatible")
+EXPECT_SHELL_LOG_CONTAINS(f"Table `{tested_schema}`.`t_no_pk` will not use BULK LOAD: LOCAL input requires a primary key")
+
+compare_schema(session1, session2, tested_schema, check_rows=True)
+
+#@<> BULK LOAD with LOCAL input - cleanup {not __dbug_off and __version_num >= 80400}
+testutil.dbug_set("")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+shell.connect(__sandbox_uri2)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+disable_bulk_load(session)
+
+#@<> dump manifest - setup {VER(>= 8.0.0)}
+tested_schema = "dump_manifest"
+dump_dir = os.path.join(outdir, "dump_manifest")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+session.run_sql("CREATE SCHEMA !", [tested_schema])
+session.run_sql("CREATE TABLE !.t1 (id INT PRIMARY KEY, data VARCHAR(32)) CHARSET utf8mb4 COLLATE utf8mb4_0900_ai_ci", [tested_schema])
+session.run_sql("CREATE TABLE !.t2 (id INT PRIMARY KEY, data VARCHAR(32)) CHARSET utf8mb4 COLLATE utf8mb4_0900_ai_ci", [tested_schema])
+session.run_sql("CREATE VIEW !.v1 AS SELECT * FROM !.t1", [tested_schema, tested_schema])
+session.run_sql("INSERT INTO !.t1 VALUES (1, 'one'), (2, 'two')", [tested_schema])
+session.run_sql("INSERT INTO !.t2 VALUES (1, 'one'), (2, 'two')", [tested_schema])
+
+EXPECT_NO_THROWS(lambda: util.dump_schemas([tested_schema], dump_dir, { "showProgress": False }), "Dump should not fail")
+
+def load_with_manifest():
+    shell.connect(__sandbox_uri2)
+    wipeout_server(session)
+    old_log_level = shell.options["logLevel"]
+    shell.options["logLevel"] = 6
+    WIPE_SHELL_LOG()
+    EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "showProgress": False }), "Load should not fail")
+    shell.options["logLevel"] = old_log_level
+
+#@<> dump manifest - manifest is written and used {VER(>= 8.0.0)}
+# manifest is written before @.done.json
+EXPECT_TRUE(os.path.isfile(os.path.join(dump_dir, "@.manifest")))
+
+load_with_manifest()
+
+EXPECT_SHELL_LOG_CONTAINS("Dump manifest with ")
+# all metadata files and DDL scripts are read from the manifest
+EXPECT_SHELL_LOG_NOT_CONTAINS("not in the dump manifest, fetching the file")
+EXPECT_SHELL_LOG_NOT_CONTAINS("file was modified after the dump was created")
+compare_schema(session1, session2, tested_schema, check_rows=True)
+
+#@<> dump manifest - modified file is not read from the manifest {VER(>= 8.0.0)}
+ddl_file = os.path.join(dump_dir, f"{tested_schema}@t2.sql")
+with open(ddl_file, encoding="utf-8") as f:
+    ddl = f.read()
+EXPECT_TRUE("utf8mb4_0900_ai_ci" in ddl)
+
+# size of the file does not change
+with open(ddl_file, "w", encoding="utf-8") as f:
+    f.write(ddl.replace("utf8mb4_0900_ai_ci", "utf8mb4_general_ci"))
+
+load_with_manifest()
+
+EXPECT_SHELL_LOG_CONTAINS(f"{tested_schema}@t2.sql: file was modified after the dump was created, it will be fetched separately")
+EXPECT_SHELL_LOG_CONTAINS(f"{tested_schema}@t2.sql: not in the dump manifest, fetching the file")
+EXPECT_SHELL_LOG_NOT_CONTAINS(f"{tested_schema}@t1.sql: not in the dump manifest")
+EXPECT_EQ("utf8mb4_general_ci", session.run_sql("SELECT TABLE_COLLATION FROM information_schema.tables WHERE TABLE_SCHEMA = ? AND TABLE_NAME = 't2'", [tested_schema]).fetch_one()[0])
+EXPECT_EQ("utf8mb4_0900_ai_ci", session.run_sql("SELECT TABLE_COLLATION FROM information_schema.tables WHERE TABLE_SCHEMA = ? AND TABLE_NAME = 't1'", [tested_schema]).fetch_one()[0])
+EXPECT_EQ(2, session.run_sql("SELECT COUNT(*) FROM !.t2", [tested_schema]).fetch_one()[0])
+
+#@<> dump manifest - cleanup {VER(>= 8.0.0)}
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+
 #@<> Cleanup
 testutil.destroy_sandbox(__mysql_sandbox_port1)
 testutil.destroy_sandbox(__mysql_sandbox_port2)
@@ -741,6 +741,45 @@ EXPECT_FAIL("ValueError", "Argument #2: The value of 'bytesPerChunk' option must
 EXPECT_FAIL("ValueError", "Argument #2: The value of 'bytesPerChunk' option must be greater than or equal to 128k.", test_output_relative, { "bytesPerChunk": "0" })
 EXPECT_FAIL("ValueError", 'Argument #2: Input number "-1" cannot be negative', test_output_relative, { "bytesPerChunk": "-1" })
 
+#@<> the `options` dictionary may contain an `adaptiveChunking` key, number of rows per chunk is then adjusted using sizes of the already dumped rows
+TEST_BOOL_OPTION("adaptiveChunking")
+
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "adaptiveChunking": True, "chunking": False, "showProgress": False })
+
+#@<> adaptiveChunking - chunk sizes are adjusted when table statistics are not accurate
+adaptive_schema = "adaptive_chunking"
+adaptive_table = "t"
+session.run_sql("DROP SCHEMA IF EXISTS !;", [ adaptive_schema ])
+session.run_sql("CREATE SCHEMA !;", [ adaptive_schema ])
+session.run_sql("CREATE TABLE !.! (`id` INT AUTO_INCREMENT PRIMARY KEY, `data` TEXT) STATS_PERSISTENT=1 STATS_AUTO_RECALC=0;", [ adaptive_schema, adaptive_table ])
+session.run_sql("INSERT INTO !.! (`data`) WITH RECURSIVE s (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM s WHERE n < 20000) SELECT 'a' FROM s;", [ adaptive_schema, adaptive_table ])
+session.run_sql("ANALYZE TABLE !.!;", [ adaptive_schema, adaptive_table ])
+# statistics are not updated, rows are now much bigger than the average row length
+session.run_sql("UPDATE !.! SET `data` = REPEAT('a', 2000);", [ adaptive_schema, adaptive_table ])
+
+def adaptive_chunk_sizes():
+    files = [ f for f in os.listdir(test_output_absolute) if f.startswith(f"{adaptive_schema}@{adaptive_table}@") and f.endswith(".tsv") ]
+    index = lambda f: int(f[:-len(".tsv")].split("@")[-1])
+    return [ os.path.getsize(os.path.join(test_output_absolute, f)) for f in sorted(files, key=index) ]
+
+bytes_per_chunk = 128 * 1024
+options = { "bytesPerChunk": "128k", "compression": "none", "threads": 1, "showProgress": False }
+
+EXPECT_SUCCESS([adaptive_schema], test_output_absolute, options)
+sizes = adaptive_chunk_sizes()
+# chunks are too big
+EXPECT_GT(max(sizes), 4 * bytes_per_chunk, f"chunk sizes: {sizes}")
+
+WIPE_SHELL_LOG()
+EXPECT_SUCCESS([adaptive_schema], test_output_absolute, { **options, "adaptiveChunking": True })
+EXPECT_SHELL_LOG_CONTAINS(f"Adjusting rows per chunk of `{adaptive_schema}`.`{adaptive_table}`")
+sizes = adaptive_chunk_sizes()
+# first chunk is created before any data is written, last one may be smaller
+for size in sizes[1:-1]:
+    EXPECT_BETWEEN(bytes_per_chunk / 2, 2 * bytes_per_chunk, size, f"chunk sizes: {sizes}")
+
+session.run_sql("DROP SCHEMA !;", [ adaptive_schema ])
+
 #@<> WL13807-FR4.14 - The `options` dictionary may contain a `threads` key with an unsigned integer value, which specifies the number of threads to be used to perform the dump.
 # WL13807-TSFR_3_54
 TEST_UINT_OPTION("threads")
@@ -758,6 +797,17 @@ EXPECT_FAIL("ValueError", "Argument #2: The value of 'threads' option must be gr
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "ddlOnly": True, "showProgress": False })
 EXPECT_STDOUT_CONTAINS("Running data dump using 4 threads.")
 
+#@<> the `options` dictionary may contain a `ddlThreads` key, DDL is then dumped using a dedicated set of threads
+TEST_UINT_OPTION("ddlThreads")
+
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "ddlThreads": 3, "ddlOnly": True, "showProgress": False })
+EXPECT_STDOUT_CONTAINS("Running data dump using 4 threads.")
+
+for table in session.run_sql("SELECT TABLE_NAME FROM information_schema.tables WHERE TABLE_SCHEMA = ?", [types_schema]).fetch_all():
+    EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, table[0]) + ".sql")))
+
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "ddlThreads": 2, "dataOnly": True, "showProgress": False })
+
 #@<> WL13807: WL13804-FR5.1 - The `options` dictionary may contain a `maxRate` key with a string value, which specifies the limit of data read throughput in bytes per second per thread.
 TEST_STRING_OPTION("maxRate")
 
@@ -873,6 +923,9 @@ EXPECT_FAIL("ValueError", "Argument #2: Unknown compression type: dummy", test_o
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "zstd", "chunking": False, "showProgress": False })
 EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.zst")))
 
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "lz4", "chunking": False, "showProgress": False })
+EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.lz4")))
+
 #@<> WL13807: WL13804-FR5.3.2 - If the `compression` option is not given, a default value of `"none"` must be used instead.
 # WL13807-FR3 - Both new functions must accept the following options specified in WL#13804, FR5:
 # * The `compression` option specified in WL#13804, FR5.3, with the modification of FR5.3.2, the default value must be`"zstd"`.
@@ -889,6 +942,9 @@ EXPECT_FAIL("ValueError", "Argument #2: Invalid compression option for gzip: sup
 EXPECT_FAIL("ValueError", "Argument #2: Invalid compression option for zstd: superfast", test_output_relative, {"compression": "zstd;level=2;superfast=1"})
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "zstd;level=20", "showProgress": False })
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "gzip;level=9", "showProgress": False })
+EXPECT_FAIL("ValueError", "Argument #2: Invalid compression level for lz4: 13", test_output_relative, {"compression": "lz4;level=13"})
+EXPECT_FAIL("ValueError", "Argument #2: Invalid compression option for lz4: superfast", test_output_relative, {"compression": "lz4;superfast=1"})
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "lz4;level=9", "showProgress": False })
 
 #@<> WL13807: WL13804-FR5.4 - The `options` dictionary may contain a `osBucketName` key with a string value, which specifies the OCI bucket name where the data dump files are going to be stored.
 # WL13807-TSFR_3_58
@@ -2,6 +2,7 @@
 
 #@<> entry point
 # imports
+import gzip
 import hashlib
 import json
 import os
@@ -1327,6 +1328,30 @@ session.run_sql("CREATE VIEW !.! AS SELECT * FROM !.!", [ schema_name, test_view
 TEST_LOAD(schema_name, test_view, source_table = no_partitions_table_name)
 TEST_LOAD(schema_name, test_view, { "where": "id > 12345" }, source_table = no_partitions_table_name)
 
+#@<> exportTable using multiple threads
+def read_output(compression):
+    with open(test_output_absolute, "rb") as f:
+        data = f.read()
+    return gzip.decompress(data) if "gzip" == compression else data
+
+for compression in [ "none", "gzip" ]:
+    options = { "compression": compression, "showProgress": False }
+    EXPECT_SUCCESS(quote(schema_name, no_partitions_table_name), test_output_absolute, options)
+    expected = read_output(compression)
+    options.update({ "threads": 4, "bytesPerChunk": "128k" })
+    EXPECT_SUCCESS(quote(schema_name, no_partitions_table_name), test_output_absolute, options)
+    EXPECT_STDOUT_CONTAINS("Running data dump using 4 threads.")
+    # data is merged in order, temporary files are removed
+    EXPECT_EQ(expected, read_output(compression))
+    EXPECT_EQ([ os.path.basename(test_output_absolute) ], os.listdir(test_output_absolute_parent))
+
+TEST_LOAD(schema_name, no_partitions_table_name, { "threads": 4, "bytesPerChunk": "128k" })
+TEST_LOAD(schema_name, partitions_table_name, { "threads": 4, "bytesPerChunk": "128k", "partitions": [ "x1", "x2" ] })
+
+#@<> exportTable using multiple threads - invalid options
+EXPECT_FAIL("ValueError", "Argument #3: The value of 'threads' option must be greater than 0.", quote(schema_name, no_partitions_table_name), test_output_absolute, { "threads": 0 })
+EXPECT_FAIL("ValueError", "Argument #3: The value of 'bytesPerChunk' option must be greater than or equal to 128k.", quote(schema_name, no_partitions_table_name), test_output_absolute, { "threads": 4, "bytesPerChunk": "1k" })
+
 #@<> WL15311 - cleanup
 session.run_sql("DROP SCHEMA !;", [schema_name])
 
@@ -192,6 +192,12 @@ class Shell_cmdline_options : public tests::Shell_base_test {
       return options->mysql_plugin_dir;
     else if (option == "log-sql")
       return options->log_sql;
+    else if (option == "sql_batch_size")
+      return AS__STRING(options->sql_batch_size);
+    else if (option == "startup_profile")
+      return AS__STRING(options->startup_profile);
+    else if (option == "lazy_init")
+      return AS__STRING(options->lazy_init);
 #ifdef _WIN32
     else if (option == "plugin-authentication-kerberos-client-mode")
       return options->connection_options().get_kerberos_auth_mode();
@@ -774,6 +780,9 @@ TEST_F(Shell_cmdline_options, default_values) {
 
   EXPECT_FALSE(options.interactive);
   EXPECT_EQ(options.log_level, shcore::Logger::LOG_INFO);
+  EXPECT_EQ(1, options.sql_batch_size);
+  EXPECT_FALSE(options.startup_profile);
+  EXPECT_FALSE(options.lazy_init);
   EXPECT_EQ("table", options.result_format);
   EXPECT_EQ("off", options.wrap_json);
   EXPECT_FALSE(options.connection_options().has_password());
@@ -946,6 +955,15 @@ TEST_F(Shell_cmdline_options, app) {
   test_option_with_no_value("--passwords-from-stdin", "passwords_from_stdin",
                             "1");
 
+  test_option_with_no_value("--startup-profile", "startup_profile", "1");
+  test_option_with_no_value("--lazy-init", "lazy_init", "1");
+
+  test_option_equal_value("sql-batch-size", "100", false, "sql_batch_size");
+  test_option_equal_invalid_value("sql-batch-size", "0",
+                                  "Invalid value for --sql-batch-size: 0\n");
+  test_option_equal_invalid_value(
+      "sql-batch-size", "many", "Invalid value for --sql-batch-size: many\n");
+
   test_option_with_value("file", "f", "/some/file", "", !IS_CONNECTION_DATA,
                          !IS_NULLABLE, "run_file");
 
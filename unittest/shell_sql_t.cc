@@ -24,7 +24,9 @@
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "gtest_clean.h"
 #include "scripting/lang_base.h"
@@ -548,5 +550,113 @@ TEST_F(Shell_sql_test, batch_script_error) {
 
 TEST_F(Shell_sql_test, batch_script_error_force) {}
 
+class Shell_sql_batch_test : public Shell_sql_test {
+ protected:
+  void SetUp() override {
+    Shell_sql_test::SetUp();
+
+    _options->interactive = false;
+    _options->sql_batch_size = 10;
+
+    env.shell_sql->set_result_processor(
+        std::bind(&Shell_sql_test::process_sql_result, this, _1, _2));
+
+    run_sql("DROP SCHEMA IF EXISTS sql_batch_test");
+    run_sql("CREATE SCHEMA sql_batch_test");
+    run_sql("CREATE TABLE sql_batch_test.t (id INT PRIMARY KEY)");
+  }
+
+  void TearDown() override {
+    run_sql("DROP SCHEMA IF EXISTS sql_batch_test");
+
+    _options->force = false;
+    _options->sql_batch_size = 1;
+
+    Shell_sql_test::TearDown();
+  }
+
+  void run_sql(const std::string &sql) {
+    env.shell_core->get_dev_session()->get_core_session()->execute(sql);
+  }
+
+  bool process(const std::string &script) {
+    std::stringstream stream{script};
+    return env.shell_sql->handle_input_stream(&stream);
+  }
+
+  std::vector<int> ids() {
+    const auto result =
+        env.shell_core->get_dev_session()->get_core_session()->query(
+            "SELECT id FROM sql_batch_test.t ORDER BY id");
+    std::vector<int> ret;
+
+    while (const auto row = result->fetch_one()) {
+      ret.emplace_back(row->get_int(0));
+    }
+
+    return ret;
+  }
+};
+
+TEST_F(Shell_sql_batch_test, statements_executed_in_order) {
+  EXPECT_TRUE(process(
+      "INSERT INTO sql_batch_test.t VALUES (1);\n"
+      "INSERT INTO sql_batch_test.t VALUES (2);\n"
+      "UPDATE sql_batch_test.t SET id = 3 WHERE id = 2;\n"
+      "SELECT * FROM sql_batch_test.t;\n"
+      "DELETE FROM sql_batch_test.t WHERE id = 1;\n"
+      "INSERT INTO sql_batch_test.t VALUES (4);\n"));
+
+  EXPECT_EQ((std::vector<int>{3, 4}), ids());
+  MY_EXPECT_STDERR_EMPTY();
+}
+
+TEST_F(Shell_sql_batch_test, error_stops_execution) {
+  EXPECT_FALSE(process(
+      "INSERT INTO sql_batch_test.t VALUES (1);\n"
+      "\n"
+      "INSERT INTO sql_batch_test.missing VALUES (2);\n"
+      "INSERT INTO sql_batch_test.t VALUES (3);\n"));
+
+  // error is reported with the line number of the failed statement
+  MY_EXPECT_STDERR_CONTAINS("ERROR: 1146 (42S02) at line 3: ");
+  // statements which follow the failed one are not executed
+  EXPECT_EQ((std::vector<int>{1}), ids());
+}
+
+TEST_F(Shell_sql_batch_test, error_with_force) {
+  _options->force = true;
+
+  EXPECT_TRUE(process(
+      "INSERT INTO sql_batch_test.t VALUES (1);\n"
+      "INSERT INTO sql_batch_test.t VALUES (1);\n"
+      "INSERT INTO sql_batch_test.t VALUES (2);\n"
+      "INSERT INTO sql_batch_test.missing VALUES (3);\n"
+      "INSERT INTO sql_batch_test.t VALUES (4);\n"));
+
+  // each error is reported, execution continues with the next statement
+  MY_EXPECT_STDERR_CONTAINS("ERROR: 1062 (23000) at line 2: ");
+  MY_EXPECT_STDERR_CONTAINS("ERROR: 1146 (42S02) at line 4: ");
+  EXPECT_EQ((std::vector<int>{1, 2, 4}), ids());
+}
+
+TEST_F(Shell_sql_batch_test, batch_larger_than_limit) {
+  _options->sql_batch_size = 2;
+
+  std::string script;
+
+  for (int i = 1; i <= 5; ++i) {
+    script += "INSERT INTO sql_batch_test.t VALUES (" + std::to_string(i) +
+              ");\n";
+  }
+
+  script += "INSERT INTO sql_batch_test.t VALUES (5);\n";
+
+  EXPECT_FALSE(process(script));
+
+  MY_EXPECT_STDERR_CONTAINS("ERROR: 1062 (23000) at line 6: ");
+  EXPECT_EQ((std::vector<int>{1, 2, 3, 4, 5}), ids());
+}
+
 }  // namespace sql_shell_tests
 }  // namespace shcore